@@ -0,0 +1,150 @@
+/**
+ * Compares the search algorithms of estd/algorithm.h with their STL
+ * counterparts on vectors of 8, 16 and 32 bit integers.
+ * \file
+ * \ingroup estl
+ * \copyright   E.S.R.Labs AG, 2014, All rights reserved.
+ */
+
+#include <algorithm>
+
+#include <estd/algorithm.h>
+#include <estd/vector.h>
+
+#include "benchmark.h"
+
+using namespace esrlabs::estd;
+
+static const std::size_t MAX_SIZE = 16384;
+
+/*
+ * The searched values do not occur in the vector, so every search scans
+ * all elements.
+ */
+static const uint8_t ABSENT[] = { 200, 201, 202, 203 };
+
+struct estd_algorithms
+{
+    template<class T>
+    static const T* find(const T* first, const T* last, T value)
+    { return ::esrlabs::estd::find(first, last, value); }
+
+    template<class T>
+    static std::ptrdiff_t count(const T* first, const T* last, T value)
+    { return ::esrlabs::estd::count(first, last, value); }
+
+    template<class T>
+    static const T* find_first_of(const T* first, const T* last)
+    { return ::esrlabs::estd::find_first_of(first, last, ABSENT, ABSENT + 4); }
+
+    template<class T>
+    static const T* min_element(const T* first, const T* last)
+    { return ::esrlabs::estd::min_element(first, last); }
+};
+
+struct std_algorithms
+{
+    template<class T>
+    static const T* find(const T* first, const T* last, T value)
+    { return std::find(first, last, value); }
+
+    template<class T>
+    static std::ptrdiff_t count(const T* first, const T* last, T value)
+    { return std::count(first, last, value); }
+
+    template<class T>
+    static const T* find_first_of(const T* first, const T* last)
+    { return std::find_first_of(first, last, ABSENT, ABSENT + 4); }
+
+    template<class T>
+    static const T* min_element(const T* first, const T* last)
+    { return std::min_element(first, last); }
+};
+
+enum Operation
+{
+    FIND,
+    COUNT,
+    FIND_FIRST_OF,
+    MIN_ELEMENT
+};
+
+/*
+ * Runs one operation over all elements of a vector.
+ */
+template<class T, class Algorithms>
+struct Search
+{
+    vector<T>& v;
+    Operation const operation;
+
+    Search(vector<T>& v_, Operation operation_) : v(v_), operation(operation_) {}
+
+    void setup() {}
+
+    std::size_t run()
+    {
+        const T* const first = &v[0];
+        const T* const last = first + v.size();
+        switch (operation)
+        {
+        case FIND:
+            benchmark::do_not_optimize(Algorithms::find(first, last, static_cast<T>(ABSENT[0])));
+            break;
+        case COUNT:
+            benchmark::do_not_optimize(Algorithms::count(first, last, static_cast<T>(ABSENT[0])));
+            break;
+        case FIND_FIRST_OF:
+            benchmark::do_not_optimize(Algorithms::find_first_of(first, last));
+            break;
+        default:
+            benchmark::do_not_optimize(Algorithms::min_element(first, last));
+            break;
+        }
+        return v.size();
+    }
+};
+
+template<class T, class Algorithms>
+void run(benchmark::suite& suite, const char* name, vector<T>& v)
+{
+    Search<T, Algorithms> find(v, FIND);
+    suite.run("find (per element)", name, sizeof(T), v.size(), find);
+    Search<T, Algorithms> count(v, COUNT);
+    suite.run("count (per element)", name, sizeof(T), v.size(), count);
+    Search<T, Algorithms> findFirstOf(v, FIND_FIRST_OF);
+    suite.run("find_first_of 4 (per element)", name, sizeof(T), v.size(), findFirstOf);
+    Search<T, Algorithms> minElement(v, MIN_ELEMENT);
+    suite.run("min_element (per element)", name, sizeof(T), v.size(), minElement);
+}
+
+template<class T>
+void run(benchmark::suite& suite, std::size_t size)
+{
+    static declare::vector<T, MAX_SIZE> v;
+    v.clear();
+    uint32_t random = 1;
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        random = random * 1103515245U + 12345U;
+        // leaves out the values searched for
+        v.push_back(static_cast<T>((random >> 16) % 200));
+    }
+    run<T, estd_algorithms>(suite, "estd", v);
+    run<T, std_algorithms>(suite, "std", v);
+}
+
+int main(int argc, char* argv[])
+{
+    benchmark::suite suite(argc, argv);
+
+    static std::size_t const sizes[] = { 64, 1024, MAX_SIZE };
+    for (std::size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); ++i)
+    {
+        run<uint8_t>(suite, sizes[i]);
+        run<uint16_t>(suite, sizes[i]);
+        run<uint32_t>(suite, sizes[i]);
+    }
+
+    return suite.finish();
+}
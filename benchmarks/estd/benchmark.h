@@ -0,0 +1,216 @@
+/**
+ * Contains a minimal, dependency free harness for the estl benchmarks.
+ * \file
+ * \ingroup estl
+ * \copyright   E.S.R.Labs AG, 2014, All rights reserved.
+ */
+#ifndef ESTD_BENCHMARK_H
+#define ESTD_BENCHMARK_H
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <estd/estdint.h>
+
+namespace esrlabs {
+namespace estd {
+namespace benchmark {
+
+    /**
+     * Returns a monotonic timestamp in nanoseconds.
+     */
+    inline uint64_t now()
+    {
+#if defined(CLOCK_MONOTONIC)
+        timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return static_cast<uint64_t>(ts.tv_sec) * 1000000000u + static_cast<uint64_t>(ts.tv_nsec);
+#else
+        return static_cast<uint64_t>(std::clock()) * (1000000000u / CLOCKS_PER_SEC);
+#endif
+    }
+
+    /**
+     * Prevents the compiler from optimizing away the computation of value.
+     */
+    template<class T>
+    inline void do_not_optimize(const T& value)
+    {
+#ifdef __GNUC__
+        __asm__ __volatile__("" : : "r"(&value) : "memory");
+#else
+        static volatile const void* sink;
+        sink = &value;
+#endif
+    }
+
+    /**
+     * A trivially copyable element of the given size in bytes.
+     */
+    template<std::size_t Size>
+    struct payload
+    {
+        uint8_t data[Size];
+    };
+
+    /**
+     * Runs benchmark cases and reports their results either as a table
+     * or, if the program is started with --json, as a JSON array.
+     *
+     * A benchmark case is a class providing the two methods
+     * - void setup(), which prepares a single measurement and is not timed.
+     * - std::size_t run(), which is timed and returns the number of
+     *   operations it performed.
+     *
+     * Every case is measured repeatedly until the minimum time is reached,
+     * the fastest measurement is reported in nanoseconds per operation.
+     *
+     * Supported command line arguments:
+     * - --json             Print the results as JSON.
+     * - --filter=TEXT      Run only cases whose name contains TEXT.
+     * - --min-time=MS      Minimum time in milliseconds spent on each case.
+     */
+    class suite
+    {
+    public:
+        suite(int argc, char* argv[]);
+
+        /**
+         * Measures a benchmark case and reports the result.
+         *
+         * \param name          Name of the operation.
+         * \param container     Name of the measured container.
+         * \param elementSize   Size of the elements in bytes.
+         * \param capacity      Capacity of the container.
+         * \param c             The benchmark case.
+         */
+        template<class Case>
+        void run(
+            const char* name,
+            const char* container,
+            std::size_t elementSize,
+            std::size_t capacity,
+            Case& c);
+
+        /**
+         * Completes the report. Returns the exit code of the program.
+         */
+        int finish();
+
+    private:
+        bool _json;
+        const char* _filter;
+        uint64_t _minTime;
+        std::size_t _count;
+    };
+
+/*
+ *
+ * Implementation
+ *
+ */
+
+inline
+suite::suite(int argc, char* argv[])
+:   _json(false)
+,   _filter(0L)
+,   _minTime(20000000u)
+,   _count(0)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "--json") == 0)
+        {
+            _json = true;
+        }
+        else if (strncmp(argv[i], "--filter=", 9) == 0)
+        {
+            _filter = argv[i] + 9;
+        }
+        else if (strncmp(argv[i], "--min-time=", 11) == 0)
+        {
+            _minTime = static_cast<uint64_t>(atoi(argv[i] + 11)) * 1000000u;
+        }
+        else
+        {
+            fprintf(stderr, "usage: %s [--json] [--filter=TEXT] [--min-time=MS]\n", argv[0]);
+            exit(1);
+        }
+    }
+    if (_json)
+    {
+        printf("[\n");
+    }
+    else
+    {
+        printf("%-32s %-24s %8s %8s %14s\n", "benchmark", "container", "bytes", "capacity", "ns/op");
+    }
+}
+
+template<class Case>
+void
+suite::run(
+    const char* name,
+    const char* container,
+    std::size_t elementSize,
+    std::size_t capacity,
+    Case& c)
+{
+    if ((_filter != 0L) && (strstr(name, _filter) == 0L))
+    {
+        return;
+    }
+    double best = 0.0;
+    uint64_t total = 0;
+    for (uint32_t repetition = 0; (total < _minTime) && (repetition < 100000u); ++repetition)
+    {
+        c.setup();
+        uint64_t const start = now();
+        std::size_t const operations = c.run();
+        uint64_t const duration = now() - start;
+        total += duration;
+        double const nsPerOp = static_cast<double>(duration) / (operations > 0 ? operations : 1);
+        if ((repetition == 0) || (nsPerOp < best))
+        {
+            best = nsPerOp;
+        }
+    }
+    if (_json)
+    {
+        printf("%s  {\"benchmark\": \"%s\", \"container\": \"%s\", \"element_size\": %lu, "
+               "\"capacity\": %lu, \"ns_per_op\": %.3f}",
+            (_count > 0) ? ",\n" : "",
+            name, container,
+            static_cast<unsigned long>(elementSize),
+            static_cast<unsigned long>(capacity),
+            best);
+    }
+    else
+    {
+        printf("%-32s %-24s %8lu %8lu %14.2f\n",
+            name, container,
+            static_cast<unsigned long>(elementSize),
+            static_cast<unsigned long>(capacity),
+            best);
+    }
+    fflush(stdout);
+    ++_count;
+}
+
+inline
+int
+suite::finish()
+{
+    if (_json)
+    {
+        printf("\n]\n");
+    }
+    return 0;
+}
+
+} /* namespace benchmark */
+} /* namespace estd */
+} /* namespace esrlabs */
+
+#endif /* ESTD_BENCHMARK_H */
@@ -0,0 +1,179 @@
+/**
+ * Compares estd::bitset with a vector of bytes and std::vector<bool> on
+ * searching a free slot, visiting the set bits and counting.
+ * \file
+ * \ingroup estl
+ * \copyright   E.S.R.Labs AG, 2014, All rights reserved.
+ */
+
+#include <algorithm>
+#include <vector>
+
+#include <estd/bitset.h>
+#include <estd/vector.h>
+
+#include "benchmark.h"
+
+using namespace esrlabs::estd;
+
+static const std::size_t SIZE = 4096;
+
+static declare::bitset<SIZE> bits;
+static declare::vector<uint8_t, SIZE> bytes;
+static std::vector<bool> bools(SIZE);
+
+enum Operation
+{
+    FIND_FREE,
+    VISIT,
+    COUNT
+};
+
+struct Sum
+{
+    std::size_t sum;
+
+    Sum() : sum(0) {}
+
+    void operator()(std::size_t i) { sum += i; }
+};
+
+/*
+ * Fills all three sets with every tenth slot used, or all slots used
+ * except one for the free slot search.
+ */
+static void fill(Operation operation, std::size_t freeSlot)
+{
+    bits.reset();
+    bytes.assign(SIZE, 0);
+    bools.assign(SIZE, false);
+    for (std::size_t i = 0; i < SIZE; ++i)
+    {
+        bool const used = (operation == FIND_FREE) ? (i != freeSlot) : (i % 10 == 0);
+        bits.set(i, used);
+        bytes[i] = used ? 1 : 0;
+        bools[i] = used;
+    }
+}
+
+struct BitsetCase
+{
+    Operation const operation;
+
+    explicit BitsetCase(Operation operation_) : operation(operation_) {}
+
+    void setup() {}
+
+    std::size_t run()
+    {
+        std::size_t result = 0;
+        switch (operation)
+        {
+        case FIND_FREE:
+            result = bits.find_first_unset();
+            break;
+        case VISIT:
+            result = bits.for_each_set(Sum()).sum;
+            break;
+        default:
+            result = bits.count();
+            break;
+        }
+        benchmark::do_not_optimize(result);
+        return 1;
+    }
+};
+
+struct BytesCase
+{
+    Operation const operation;
+
+    explicit BytesCase(Operation operation_) : operation(operation_) {}
+
+    void setup() {}
+
+    std::size_t run()
+    {
+        std::size_t result = 0;
+        switch (operation)
+        {
+        case FIND_FREE:
+            result = static_cast<std::size_t>(
+                std::find(bytes.begin(), bytes.end(), 0) - bytes.begin());
+            break;
+        case VISIT:
+            for (std::size_t i = 0; i < SIZE; ++i)
+            {
+                if (bytes[i] != 0)
+                {
+                    result += i;
+                }
+            }
+            break;
+        default:
+            result = static_cast<std::size_t>(std::count(bytes.begin(), bytes.end(), 1));
+            break;
+        }
+        benchmark::do_not_optimize(result);
+        return 1;
+    }
+};
+
+struct BoolsCase
+{
+    Operation const operation;
+
+    explicit BoolsCase(Operation operation_) : operation(operation_) {}
+
+    void setup() {}
+
+    std::size_t run()
+    {
+        std::size_t result = 0;
+        switch (operation)
+        {
+        case FIND_FREE:
+            result = static_cast<std::size_t>(
+                std::find(bools.begin(), bools.end(), false) - bools.begin());
+            break;
+        case VISIT:
+            for (std::size_t i = 0; i < SIZE; ++i)
+            {
+                if (bools[i])
+                {
+                    result += i;
+                }
+            }
+            break;
+        default:
+            result = static_cast<std::size_t>(std::count(bools.begin(), bools.end(), true));
+            break;
+        }
+        benchmark::do_not_optimize(result);
+        return 1;
+    }
+};
+
+static void run(benchmark::suite& suite, const char* name, Operation operation)
+{
+    BitsetCase bitset(operation);
+    suite.run(name, "estd::bitset", 1, SIZE, bitset);
+    BytesCase vector(operation);
+    suite.run(name, "estd::vector<uint8_t>", 1, SIZE, vector);
+    BoolsCase vectorBool(operation);
+    suite.run(name, "std::vector<bool>", 1, SIZE, vectorBool);
+}
+
+int main(int argc, char* argv[])
+{
+    benchmark::suite suite(argc, argv);
+
+    // the free slot in the middle, so half of the set is scanned
+    fill(FIND_FREE, SIZE / 2);
+    run(suite, "find free slot", FIND_FREE);
+    fill(VISIT, 0);
+    run(suite, "visit used slots", VISIT);
+    run(suite, "count used slots", COUNT);
+
+    return suite.finish();
+}
@@ -0,0 +1,98 @@
+/**
+ * Compares estd::deque used as FIFO with estd::vector, which has to shift
+ * all elements when removing the first one, and std::deque.
+ * \file
+ * \ingroup estl
+ * \copyright   E.S.R.Labs AG, 2014, All rights reserved.
+ */
+
+#include <deque>
+
+#include <estd/deque.h>
+#include <estd/vector.h>
+
+#include "benchmark.h"
+
+using namespace esrlabs::estd;
+
+template<class T>
+void pop_front(std::deque<T>& d)
+{
+    d.pop_front();
+}
+
+template<class T>
+void pop_front(deque<T>& d)
+{
+    d.pop_front();
+}
+
+template<class T>
+void pop_front(vector<T>& v)
+{
+    v.erase(v.begin());
+}
+
+/*
+ * Keeps the FIFO half filled and pushes and pops one element per operation.
+ */
+template<class Fifo>
+struct PushPop
+{
+    static const std::size_t OPERATIONS = 4096;
+
+    Fifo& fifo;
+    std::size_t const capacity;
+
+    PushPop(Fifo& fifo_, std::size_t capacity_) : fifo(fifo_), capacity(capacity_) {}
+
+    void setup()
+    {
+        fifo.clear();
+        typename Fifo::value_type value = typename Fifo::value_type();
+        for (std::size_t i = 0; i < capacity / 2; ++i)
+        {
+            fifo.push_back(value);
+        }
+    }
+
+    std::size_t run()
+    {
+        typename Fifo::value_type value = typename Fifo::value_type();
+        for (std::size_t i = 0; i < OPERATIONS; ++i)
+        {
+            fifo.push_back(value);
+            pop_front(fifo);
+        }
+        benchmark::do_not_optimize(fifo);
+        return OPERATIONS;
+    }
+};
+
+template<class Fifo>
+void run(benchmark::suite& suite, const char* name, std::size_t capacity)
+{
+    static Fifo fifo;
+    PushPop<Fifo> pushPop(fifo, capacity);
+    suite.run("push_back/pop_front", name, sizeof(typename Fifo::value_type), capacity, pushPop);
+}
+
+template<std::size_t Size>
+void run(benchmark::suite& suite)
+{
+    typedef benchmark::payload<Size> T;
+    run<declare::deque<T, 1000> >(suite, "estd::deque", 1000);
+    run<declare::deque<T, 1024> >(suite, "estd::deque", 1024);
+    run<declare::vector<T, 1024> >(suite, "estd::vector", 1024);
+    run<std::deque<T> >(suite, "std::deque", 1024);
+}
+
+int main(int argc, char* argv[])
+{
+    benchmark::suite suite(argc, argv);
+
+    run<4>(suite);
+    run<64>(suite);
+
+    return suite.finish();
+}
@@ -0,0 +1,163 @@
+/**
+ * Compares building and looking up estd::flat_map with std::map, either
+ * inserting the elements one by one or as a range, with and without
+ * duplicate keys.
+ * \file
+ * \ingroup estl
+ * \copyright   E.S.R.Labs AG, 2014, All rights reserved.
+ */
+
+#include <algorithm>
+#include <map>
+
+#include <estd/flat_map.h>
+
+#include "benchmark.h"
+
+using namespace esrlabs::estd;
+
+static const std::size_t MAX_SIZE = 4096;
+static const std::size_t LOOKUPS = 4096;
+
+typedef std::pair<uint32_t, uint32_t> Element;
+
+/*
+ * Elements with scattered keys.
+ */
+static Element elements[MAX_SIZE];
+
+/*
+ * Elements with scattered keys, each key appearing twice with different
+ * values. The first of them has to be kept.
+ */
+static Element duplicates[MAX_SIZE];
+
+static void init_elements()
+{
+    for (std::size_t i = 0; i < MAX_SIZE; ++i)
+    {
+        elements[i] = Element(static_cast<uint32_t>(i) * 2654435761U, static_cast<uint32_t>(i));
+        duplicates[i] = Element(static_cast<uint32_t>(i / 2) * 2654435761U, static_cast<uint32_t>(i));
+    }
+}
+
+struct SameElement
+{
+    bool operator()(const Element& a, const std::pair<const uint32_t, uint32_t>& b) const
+    {
+        return (a.first == b.first) && (a.second == b.second);
+    }
+};
+
+/*
+ * Checks that a range with duplicate keys results in the same elements
+ * as with std::map.
+ */
+static bool keeps_first_duplicates()
+{
+    static declare::flat_map<uint32_t, uint32_t, MAX_SIZE> flat;
+    flat.clear();
+    flat.insert(duplicates, duplicates + MAX_SIZE);
+    std::map<uint32_t, uint32_t> const map(duplicates, duplicates + MAX_SIZE);
+    return (flat.size() == map.size()) && std::equal(flat.begin(), flat.end(), map.begin(), SameElement());
+}
+
+/*
+ * Inserts count elements one by one or as one range.
+ */
+template<class Map>
+struct Build
+{
+    Map& map;
+    const Element* const data;
+    std::size_t const count;
+    bool const range;
+
+    Build(Map& map_, const Element* data_, std::size_t count_, bool range_)
+    :   map(map_), data(data_), count(count_), range(range_) {}
+
+    void setup()
+    {
+        map.clear();
+    }
+
+    std::size_t run()
+    {
+        if (range)
+        {
+            map.insert(data, data + count);
+        }
+        else
+        {
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                (void)map.insert(data[i]);
+            }
+        }
+        benchmark::do_not_optimize(map);
+        return count;
+    }
+};
+
+/*
+ * Looks up the keys of a map filled with count elements.
+ */
+template<class Map>
+struct Lookup
+{
+    Map& map;
+    std::size_t const count;
+
+    Lookup(Map& map_, std::size_t count_) : map(map_), count(count_) {}
+
+    void setup()
+    {
+        map.clear();
+        map.insert(elements, elements + count);
+    }
+
+    std::size_t run()
+    {
+        uint32_t sum = 0;
+        for (std::size_t i = 0; i < LOOKUPS; ++i)
+        {
+            sum += map.find(elements[(i * 7919) % count].first)->second;
+        }
+        benchmark::do_not_optimize(sum);
+        return LOOKUPS;
+    }
+};
+
+template<class Map>
+void run(benchmark::suite& suite, const char* name, std::size_t count)
+{
+    static Map map;
+    Build<Map> single(map, elements, count, false);
+    suite.run("insert one by one", name, sizeof(Element), count, single);
+    Build<Map> range(map, elements, count, true);
+    suite.run("insert range", name, sizeof(Element), count, range);
+    Build<Map> duplicateRange(map, duplicates, count, true);
+    suite.run("insert range with duplicates", name, sizeof(Element), count, duplicateRange);
+    Lookup<Map> lookup(map, count);
+    suite.run("find", name, sizeof(Element), count, lookup);
+}
+
+int main(int argc, char* argv[])
+{
+    benchmark::suite suite(argc, argv);
+    init_elements();
+    if (!keeps_first_duplicates())
+    {
+        (void)fprintf(stderr, "estd::flat_map differs from std::map on duplicate keys\n");
+        return 1;
+    }
+
+    static std::size_t const sizes[] = { 16, 256, MAX_SIZE };
+    for (std::size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); ++i)
+    {
+        run<declare::flat_map<uint32_t, uint32_t, MAX_SIZE> >(suite, "estd::flat_map", sizes[i]);
+        run<std::map<uint32_t, uint32_t> >(suite, "std::map", sizes[i]);
+    }
+
+    return suite.finish();
+}
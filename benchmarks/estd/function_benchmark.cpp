@@ -0,0 +1,263 @@
+/**
+ * Compares estd::function with virtual functions, function pointers and
+ * std::function on dispatching messages to a table of handlers and on
+ * replacing handlers.
+ * \file
+ * \ingroup estl
+ * \copyright   E.S.R.Labs AG, 2014, All rights reserved.
+ */
+
+#if __cplusplus >= 201103L
+#include <functional>
+#endif
+
+#include <estd/function.h>
+
+#include "benchmark.h"
+
+using namespace esrlabs::estd;
+
+static const std::size_t HANDLERS = 64;
+static const std::size_t MESSAGES = 1024;
+
+static uint32_t ids[MESSAGES];
+
+struct Channel
+{
+    uint32_t received;
+    uint32_t bytes;
+};
+
+static Channel channels[HANDLERS];
+
+/*
+ * The handlers capture a channel, a factor and an offset, which does not
+ * fit into the small buffer of std::function in libstdc++.
+ */
+struct Handler
+{
+    Channel* channel;
+    uint32_t factor;
+    uint32_t offset;
+    uint64_t padding;
+
+    void operator()(uint32_t value) const
+    {
+        ++channel->received;
+        channel->bytes += value * factor + offset;
+    }
+};
+
+static Handler handler_for(std::size_t i)
+{
+    Handler const handler = { &channels[i], static_cast<uint32_t>(i), 1U, 0U };
+    return handler;
+}
+
+typedef declare::function<void(uint32_t), sizeof(Handler)> Function;
+
+struct EstdFunction
+{
+    Function handlers[HANDLERS];
+
+    EstdFunction()
+    {
+        for (std::size_t i = 0; i < HANDLERS; ++i)
+        {
+            handlers[i] = handler_for(i);
+        }
+    }
+
+    void setup() {}
+
+    std::size_t dispatch()
+    {
+        for (std::size_t i = 0; i < MESSAGES; ++i)
+        {
+            handlers[ids[i]](ids[i]);
+        }
+        benchmark::do_not_optimize(channels);
+        return MESSAGES;
+    }
+
+    std::size_t replace()
+    {
+        for (std::size_t i = 0; i < MESSAGES; ++i)
+        {
+            handlers[ids[i]] = handler_for(ids[i]);
+        }
+        benchmark::do_not_optimize(handlers);
+        return MESSAGES;
+    }
+};
+
+struct Interface
+{
+    virtual ~Interface() {}
+    virtual void handle(uint32_t value) = 0;
+};
+
+struct Implementation
+:   public Interface
+{
+    Handler handler;
+
+    virtual void handle(uint32_t value)
+    {
+        handler(value);
+    }
+};
+
+struct Virtual
+{
+    Implementation implementations[HANDLERS];
+    Interface* handlers[HANDLERS];
+
+    Virtual()
+    {
+        for (std::size_t i = 0; i < HANDLERS; ++i)
+        {
+            implementations[i].handler = handler_for(i);
+            handlers[i] = &implementations[i];
+        }
+    }
+
+    void setup() {}
+
+    std::size_t dispatch()
+    {
+        for (std::size_t i = 0; i < MESSAGES; ++i)
+        {
+            handlers[ids[i]]->handle(ids[i]);
+        }
+        benchmark::do_not_optimize(channels);
+        return MESSAGES;
+    }
+};
+
+/*
+ * A function pointer and a context pointer, the usual C callback.
+ */
+static void handle(void* context, uint32_t value)
+{
+    (*static_cast<Handler*>(context))(value);
+}
+
+struct FunctionPointer
+{
+    Handler contexts[HANDLERS];
+    void (*handlers[HANDLERS])(void*, uint32_t);
+
+    FunctionPointer()
+    {
+        for (std::size_t i = 0; i < HANDLERS; ++i)
+        {
+            contexts[i] = handler_for(i);
+            handlers[i] = &handle;
+        }
+    }
+
+    void setup() {}
+
+    std::size_t dispatch()
+    {
+        for (std::size_t i = 0; i < MESSAGES; ++i)
+        {
+            handlers[ids[i]](&contexts[ids[i]], ids[i]);
+        }
+        benchmark::do_not_optimize(channels);
+        return MESSAGES;
+    }
+};
+
+#if __cplusplus >= 201103L
+struct StdFunction
+{
+    std::function<void(uint32_t)> handlers[HANDLERS];
+
+    StdFunction()
+    {
+        for (std::size_t i = 0; i < HANDLERS; ++i)
+        {
+            handlers[i] = handler_for(i);
+        }
+    }
+
+    void setup() {}
+
+    std::size_t dispatch()
+    {
+        for (std::size_t i = 0; i < MESSAGES; ++i)
+        {
+            handlers[ids[i]](ids[i]);
+        }
+        benchmark::do_not_optimize(channels);
+        return MESSAGES;
+    }
+
+    std::size_t replace()
+    {
+        for (std::size_t i = 0; i < MESSAGES; ++i)
+        {
+            handlers[ids[i]] = handler_for(ids[i]);
+        }
+        benchmark::do_not_optimize(handlers);
+        return MESSAGES;
+    }
+};
+#endif
+
+template<class Handlers>
+struct DispatchCase
+{
+    Handlers& handlers;
+    explicit DispatchCase(Handlers& handlers_) : handlers(handlers_) {}
+    void setup() {}
+    std::size_t run() { return handlers.dispatch(); }
+};
+
+template<class Handlers>
+struct ReplaceCase
+{
+    Handlers& handlers;
+    explicit ReplaceCase(Handlers& handlers_) : handlers(handlers_) {}
+    void setup() {}
+    std::size_t run() { return handlers.replace(); }
+};
+
+int main(int argc, char* argv[])
+{
+    benchmark::suite suite(argc, argv);
+
+    uint32_t random = 1;
+    for (std::size_t i = 0; i < MESSAGES; ++i)
+    {
+        random = random * 1103515245U + 12345U;
+        ids[i] = (random >> 8) % HANDLERS;
+    }
+
+    static EstdFunction estdFunction;
+    static Virtual virtualFunction;
+    static FunctionPointer functionPointer;
+
+    DispatchCase<EstdFunction> estdDispatch(estdFunction);
+    suite.run("dispatch a message", "estd::function", sizeof(Function), HANDLERS, estdDispatch);
+    DispatchCase<Virtual> virtualDispatch(virtualFunction);
+    suite.run("dispatch a message", "virtual function", sizeof(Implementation), HANDLERS, virtualDispatch);
+    DispatchCase<FunctionPointer> pointerDispatch(functionPointer);
+    suite.run("dispatch a message", "function pointer", sizeof(Handler), HANDLERS, pointerDispatch);
+#if __cplusplus >= 201103L
+    static StdFunction stdFunction;
+    DispatchCase<StdFunction> stdDispatch(stdFunction);
+    suite.run("dispatch a message", "std::function", sizeof(std::function<void(uint32_t)>), HANDLERS, stdDispatch);
+#endif
+
+    ReplaceCase<EstdFunction> estdReplace(estdFunction);
+    suite.run("replace a handler", "estd::function", sizeof(Function), HANDLERS, estdReplace);
+#if __cplusplus >= 201103L
+    ReplaceCase<StdFunction> stdReplace(stdFunction);
+    suite.run("replace a handler", "std::function", sizeof(std::function<void(uint32_t)>), HANDLERS, stdReplace);
+#endif
+
+    return suite.finish();
+}
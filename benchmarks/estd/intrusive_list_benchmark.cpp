@@ -0,0 +1,184 @@
+/**
+ * Compares moving tasks between a ready and a waiting list kept as
+ * estd::intrusive_list, as estd::vector of pointers and as std::list of
+ * pointers.
+ * \file
+ * \ingroup estl
+ * \copyright   E.S.R.Labs AG, 2014, All rights reserved.
+ */
+
+#include <algorithm>
+#include <list>
+
+#include <estd/intrusive_list.h>
+#include <estd/vector.h>
+
+#include "benchmark.h"
+
+using namespace esrlabs::estd;
+
+static const std::size_t MAX_SIZE = 10000;
+static const std::size_t MOVES = 1024;
+
+struct Task
+:   public intrusive_list_hook<>
+{
+    uint32_t id;
+    uint32_t data[3];
+};
+
+static declare::vector<Task, MAX_SIZE> tasks;
+
+/*
+ * The tasks to move from the ready to the waiting list and back.
+ */
+static std::size_t picks[MOVES];
+
+/*
+ * Waits for a random task, which is removed from the middle of the ready
+ * list, and makes it ready again.
+ */
+struct Intrusive
+{
+    std::size_t const count;
+    intrusive_list<Task> ready;
+    intrusive_list<Task> waiting;
+
+    explicit Intrusive(std::size_t count_) : count(count_) {}
+
+    ~Intrusive()
+    {
+        ready.clear();
+        waiting.clear();
+    }
+
+    void setup()
+    {
+        ready.clear();
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            ready.push_back(tasks[i]);
+        }
+    }
+
+    std::size_t run()
+    {
+        for (std::size_t i = 0; i < MOVES; ++i)
+        {
+            Task& task = tasks[picks[i] % count];
+            ready.erase(task);
+            waiting.push_back(task);
+            waiting.pop_front();
+            ready.push_back(task);
+        }
+        benchmark::do_not_optimize(ready);
+        return MOVES;
+    }
+};
+
+struct Vector
+{
+    std::size_t const count;
+    declare::vector<Task*, MAX_SIZE> ready;
+    declare::vector<Task*, MAX_SIZE> waiting;
+
+    explicit Vector(std::size_t count_) : count(count_) {}
+
+    void setup()
+    {
+        ready.clear();
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            ready.push_back(&tasks[i]);
+        }
+    }
+
+    std::size_t run()
+    {
+        for (std::size_t i = 0; i < MOVES; ++i)
+        {
+            Task* const task = &tasks[picks[i] % count];
+            ready.erase(std::find(ready.begin(), ready.end(), task));
+            waiting.push_back(task);
+            waiting.erase(waiting.begin());
+            ready.push_back(task);
+        }
+        benchmark::do_not_optimize(ready);
+        return MOVES;
+    }
+};
+
+/*
+ * std::list with the iterators of the tasks remembered, which makes
+ * removing constant time as well, but allocates on every insertion.
+ */
+struct StdList
+{
+    std::size_t const count;
+    std::list<Task*> ready;
+    std::list<Task*> waiting;
+    std::list<Task*>::iterator positions[MAX_SIZE];
+
+    explicit StdList(std::size_t count_) : count(count_) {}
+
+    void setup()
+    {
+        ready.clear();
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            positions[i] = ready.insert(ready.end(), &tasks[i]);
+        }
+    }
+
+    std::size_t run()
+    {
+        for (std::size_t i = 0; i < MOVES; ++i)
+        {
+            std::size_t const index = picks[i] % count;
+            Task* const task = &tasks[index];
+            ready.erase(positions[index]);
+            waiting.push_back(task);
+            waiting.pop_front();
+            positions[index] = ready.insert(ready.end(), task);
+        }
+        benchmark::do_not_optimize(ready);
+        return MOVES;
+    }
+};
+
+int main(int argc, char* argv[])
+{
+    benchmark::suite suite(argc, argv);
+
+    for (std::size_t i = 0; i < MAX_SIZE; ++i)
+    {
+        Task& task = tasks.push_back();
+        task.id = static_cast<uint32_t>(i);
+    }
+    uint32_t random = 1;
+    for (std::size_t i = 0; i < MOVES; ++i)
+    {
+        random = random * 1103515245U + 12345U;
+        picks[i] = random >> 8;
+    }
+
+    static std::size_t const sizes[] = { 10, 100, 1000, MAX_SIZE };
+    for (std::size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); ++i)
+    {
+        std::size_t const count = sizes[i];
+        {
+            Intrusive intrusive(count);
+            suite.run("wait and wake a task", "estd::intrusive_list", sizeof(Task), count, intrusive);
+        }
+        {
+            Vector v(count);
+            suite.run("wait and wake a task", "estd::vector", sizeof(Task*), count, v);
+        }
+        {
+            StdList list(count);
+            suite.run("wait and wake a task", "std::list", sizeof(Task*), count, list);
+        }
+    }
+
+    return suite.finish();
+}
@@ -0,0 +1,140 @@
+/**
+ * Measures how the throughput of estd::mpmc_queue scales with the number of
+ * producer and consumer threads and compares it with a mutex protected
+ * estd::deque.
+ * \file
+ * \ingroup estl
+ * \copyright   E.S.R.Labs AG, 2014, All rights reserved.
+ */
+
+#include <cstdio>
+
+#include <estd/mpmc_queue.h>
+
+#include "benchmark.h"
+#include "threads.h"
+
+using namespace esrlabs::estd;
+
+static const std::size_t CAPACITY = 1024;
+static const std::size_t OPERATIONS = 400000;
+static const std::size_t MAX_THREADS = 8;
+static const std::size_t BATCH = 16;
+
+template<class T>
+std::size_t enqueue_n(mpmc_queue<T>& queue, const T* values, std::size_t n)
+{
+    return queue.try_enqueue_n(values, n);
+}
+
+template<class T>
+std::size_t dequeue_n(mpmc_queue<T>& queue, T* values, std::size_t n)
+{
+    return queue.try_dequeue_n(values, n);
+}
+
+template<class T, std::size_t N>
+std::size_t enqueue_n(benchmark::locked_queue<T, N>& queue, const T* values, std::size_t n)
+{
+    return queue.try_push_n(values, n);
+}
+
+template<class T, std::size_t N>
+std::size_t dequeue_n(benchmark::locked_queue<T, N>& queue, T* values, std::size_t n)
+{
+    return queue.try_pop_n(values, n);
+}
+
+/*
+ * The given number of producers each push their share of OPERATIONS values
+ * while the same number of consumers pop them.
+ */
+template<class Queue>
+struct Scaling
+{
+    Queue queue;
+    std::size_t threads;
+    std::size_t batch;
+
+    Scaling() : queue(), threads(1), batch(1) {}
+
+    struct Worker
+    {
+        Scaling* self;
+        int cpu;
+        bool producer;
+    };
+
+    static void* work(void* arg)
+    {
+        Worker const& worker = *static_cast<Worker*>(arg);
+        Scaling& self = *worker.self;
+        benchmark::pin(worker.cpu);
+        std::size_t const share = OPERATIONS / self.threads;
+        uint32_t values[BATCH] = { 0 };
+        uint32_t spins = 0;
+        std::size_t done = 0;
+        while (done < share)
+        {
+            std::size_t const n = std::min(self.batch, share - done);
+            std::size_t const count = worker.producer
+                ? enqueue_n(self.queue, values, n)
+                : dequeue_n(self.queue, values, n);
+            if (count == 0)
+            {
+                benchmark::backoff(spins);
+            }
+            done += count;
+        }
+        return 0L;
+    }
+
+    void setup() {}
+
+    std::size_t run()
+    {
+        pthread_t ids[2 * MAX_THREADS];
+        Worker workers[2 * MAX_THREADS];
+        for (std::size_t i = 0; i < 2 * threads; ++i)
+        {
+            workers[i].self = this;
+            workers[i].cpu = static_cast<int>(i);
+            workers[i].producer = (i % 2) == 0;
+            pthread_create(&ids[i], 0L, &work, &workers[i]);
+        }
+        for (std::size_t i = 0; i < 2 * threads; ++i)
+        {
+            pthread_join(ids[i], 0L);
+        }
+        return (OPERATIONS / threads) * threads;
+    }
+};
+
+template<class Queue>
+void run(benchmark::suite& suite, const char* container)
+{
+    static Scaling<Queue> scaling;
+    for (std::size_t threads = 1; threads <= MAX_THREADS; threads *= 2)
+    {
+        scaling.threads = threads;
+
+        char name[64];
+        scaling.batch = 1;
+        sprintf(name, "%lu producers/consumers", static_cast<unsigned long>(threads));
+        suite.run(name, container, sizeof(uint32_t), CAPACITY, scaling);
+
+        scaling.batch = BATCH;
+        sprintf(name, "%lu producers/consumers batched", static_cast<unsigned long>(threads));
+        suite.run(name, container, sizeof(uint32_t), CAPACITY, scaling);
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    benchmark::suite suite(argc, argv);
+
+    run<declare::mpmc_queue<uint32_t, CAPACITY> >(suite, "estd::mpmc_queue");
+    run<benchmark::locked_queue<uint32_t, CAPACITY> >(suite, "mutex + estd::deque");
+
+    return suite.finish();
+}
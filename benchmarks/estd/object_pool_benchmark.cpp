@@ -0,0 +1,122 @@
+/**
+ * Compares estd::object_pool with malloc and free while objects are
+ * allocated and released in random order.
+ * \file
+ * \ingroup estl
+ * \copyright   E.S.R.Labs AG, 2014, All rights reserved.
+ */
+
+#include <cstdlib>
+#include <new>
+
+#include <estd/object_pool.h>
+
+#include "benchmark.h"
+
+using namespace esrlabs::estd;
+
+static const std::size_t CAPACITY = 1024;
+static const std::size_t OPERATIONS = 4096;
+
+template<class T>
+class pool_allocator
+{
+public:
+    T* allocate() { return &_pool.allocate().construct(); }
+    void release(T* object) { _pool.release(object); }
+
+private:
+    declare::object_pool<T, CAPACITY> _pool;
+};
+
+template<class T>
+class malloc_allocator
+{
+public:
+    T* allocate() { return new(malloc(sizeof(T)))T(); }
+    void release(T* object) { object->~T(); free(object); }
+};
+
+/*
+ * Keeps live objects allocated and replaces a randomly picked one per
+ * operation, so the allocations are released in a different order than
+ * they have been made.
+ */
+template<class T, class Allocator>
+struct Churn
+{
+    Allocator& allocator;
+    std::size_t const live;
+    T* objects[CAPACITY];
+    bool filled;
+    uint32_t random;
+
+    Churn(Allocator& allocator_, std::size_t live_)
+    :   allocator(allocator_), live(live_), filled(false), random(1) {}
+
+    ~Churn()
+    {
+        release_all();
+    }
+
+    void release_all()
+    {
+        for (std::size_t i = 0; filled && (i < live); ++i)
+        {
+            allocator.release(objects[i]);
+        }
+        filled = false;
+    }
+
+    void setup()
+    {
+        release_all();
+        for (std::size_t i = 0; i < live; ++i)
+        {
+            objects[i] = allocator.allocate();
+        }
+        filled = true;
+    }
+
+    std::size_t run()
+    {
+        for (std::size_t i = 0; i < OPERATIONS; ++i)
+        {
+            random = random * 1103515245U + 12345U;
+            std::size_t const victim = (random >> 16) % live;
+            allocator.release(objects[victim]);
+            objects[victim] = allocator.allocate();
+        }
+        benchmark::do_not_optimize(objects);
+        return OPERATIONS;
+    }
+};
+
+template<class T, class Allocator>
+void run(benchmark::suite& suite, const char* name, std::size_t live)
+{
+    static Allocator allocator;
+    Churn<T, Allocator> churn(allocator, live);
+    suite.run("release/allocate", name, sizeof(T), live, churn);
+}
+
+template<std::size_t Size>
+void run(benchmark::suite& suite)
+{
+    typedef benchmark::payload<Size> T;
+    run<T, pool_allocator<T> >(suite, "estd::object_pool", 64);
+    run<T, malloc_allocator<T> >(suite, "malloc/free", 64);
+    run<T, pool_allocator<T> >(suite, "estd::object_pool", CAPACITY);
+    run<T, malloc_allocator<T> >(suite, "malloc/free", CAPACITY);
+}
+
+int main(int argc, char* argv[])
+{
+    benchmark::suite suite(argc, argv);
+
+    run<16>(suite);
+    run<64>(suite);
+    run<256>(suite);
+
+    return suite.finish();
+}
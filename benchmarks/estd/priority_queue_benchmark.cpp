@@ -0,0 +1,160 @@
+/**
+ * Compares estd::priority_queue as binary and 4-ary heap with a sorted
+ * estd::vector and std::priority_queue on scheduling jobs by deadline.
+ * \file
+ * \ingroup estl
+ * \copyright   E.S.R.Labs AG, 2014, All rights reserved.
+ */
+
+#include <algorithm>
+#include <queue>
+#include <vector>
+
+#include <estd/priority_queue.h>
+#include <estd/vector.h>
+
+#include "benchmark.h"
+
+using namespace esrlabs::estd;
+
+static const std::size_t MAX_SIZE = 100000;
+
+struct Job
+{
+    uint32_t deadline;
+    uint32_t id;
+    uint32_t data[2];
+};
+
+struct LaterDeadline
+{
+    bool operator()(const Job& a, const Job& b) const { return a.deadline > b.deadline; }
+};
+
+static declare::vector<Job, MAX_SIZE> jobs;
+
+/*
+ * Pushes count jobs and pops them in the order of their deadlines.
+ */
+template<std::size_t Arity>
+struct Heap
+{
+    std::size_t const count;
+    declare::priority_queue<Job, MAX_SIZE, LaterDeadline, Arity>& queue;
+
+    Heap(std::size_t count_, declare::priority_queue<Job, MAX_SIZE, LaterDeadline, Arity>& queue_)
+    :   count(count_), queue(queue_) {}
+
+    void setup() { queue.clear(); }
+
+    std::size_t run()
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            queue.push(jobs[i]);
+        }
+        uint32_t sum = 0;
+        while (!queue.empty())
+        {
+            sum += queue.top().id;
+            queue.pop();
+        }
+        benchmark::do_not_optimize(sum);
+        return count;
+    }
+};
+
+/*
+ * Keeps the jobs sorted with the latest deadline first, so the next job
+ * is popped from the back.
+ */
+struct Sorted
+{
+    std::size_t const count;
+    declare::vector<Job, MAX_SIZE>& queue;
+
+    Sorted(std::size_t count_, declare::vector<Job, MAX_SIZE>& queue_)
+    :   count(count_), queue(queue_) {}
+
+    void setup() { queue.clear(); }
+
+    std::size_t run()
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            queue.insert(
+                std::upper_bound(queue.begin(), queue.end(), jobs[i], LaterDeadline()),
+                jobs[i]);
+        }
+        uint32_t sum = 0;
+        while (!queue.empty())
+        {
+            sum += queue.back().id;
+            queue.pop_back();
+        }
+        benchmark::do_not_optimize(sum);
+        return count;
+    }
+};
+
+struct Std
+{
+    std::size_t const count;
+
+    explicit Std(std::size_t count_) : count(count_) {}
+
+    void setup() {}
+
+    std::size_t run()
+    {
+        std::priority_queue<Job, std::vector<Job>, LaterDeadline> queue;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            queue.push(jobs[i]);
+        }
+        uint32_t sum = 0;
+        while (!queue.empty())
+        {
+            sum += queue.top().id;
+            queue.pop();
+        }
+        benchmark::do_not_optimize(sum);
+        return count;
+    }
+};
+
+int main(int argc, char* argv[])
+{
+    benchmark::suite suite(argc, argv);
+
+    uint32_t random = 1;
+    for (std::size_t i = 0; i < MAX_SIZE; ++i)
+    {
+        random = random * 1103515245U + 12345U;
+        Job const job = { random >> 8, static_cast<uint32_t>(i), { 0, 0 } };
+        jobs.push_back(job);
+    }
+
+    static declare::priority_queue<Job, MAX_SIZE, LaterDeadline> binary;
+    static declare::priority_queue<Job, MAX_SIZE, LaterDeadline, 4> quaternary;
+    static declare::vector<Job, MAX_SIZE> sorted;
+
+    static std::size_t const sizes[] = { 100, 1000, 10000, MAX_SIZE };
+    for (std::size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); ++i)
+    {
+        std::size_t const count = sizes[i];
+        Heap<2> binaryHeap(count, binary);
+        suite.run("push and pop (per element)", "estd::priority_queue", sizeof(Job), count, binaryHeap);
+        Heap<4> quaternaryHeap(count, quaternary);
+        suite.run("push and pop (per element)", "estd::priority_queue 4-ary", sizeof(Job), count, quaternaryHeap);
+        if (count <= 10000)
+        {
+            Sorted sortedVector(count, sorted);
+            suite.run("push and pop (per element)", "sorted estd::vector", sizeof(Job), count, sortedVector);
+        }
+        Std stdQueue(count);
+        suite.run("push and pop (per element)", "std::priority_queue", sizeof(Job), count, stdQueue);
+    }
+
+    return suite.finish();
+}
@@ -0,0 +1,151 @@
+/**
+ * Compares estd::radix_sort with std::sort on vectors of integers and of
+ * structs sorted by an integer member.
+ * \file
+ * \ingroup estl
+ * \copyright   E.S.R.Labs AG, 2014, All rights reserved.
+ */
+
+#include <algorithm>
+
+#include <estd/algorithm.h>
+#include <estd/vector.h>
+
+#include "benchmark.h"
+
+using namespace esrlabs::estd;
+
+static const std::size_t MAX_SIZE = 1000000;
+
+struct Record
+{
+    uint32_t timestamp;
+    uint32_t id;
+};
+
+struct RecordTimestamp
+{
+    uint32_t operator()(const Record& r) const { return r.timestamp; }
+};
+
+struct RecordLess
+{
+    bool operator()(const Record& a, const Record& b) const { return a.timestamp < b.timestamp; }
+};
+
+template<class T>
+T make(uint64_t random);
+
+template<>
+uint32_t make<uint32_t>(uint64_t random) { return static_cast<uint32_t>(random >> 32); }
+
+template<>
+uint64_t make<uint64_t>(uint64_t random) { return random; }
+
+template<>
+Record make<Record>(uint64_t random)
+{
+    Record r = { static_cast<uint32_t>(random >> 32), static_cast<uint32_t>(random) };
+    return r;
+}
+
+template<class T>
+struct key_of
+{
+    typedef internal::identity<T> type;
+    typedef std::less<T> less;
+};
+
+template<>
+struct key_of<Record>
+{
+    typedef RecordTimestamp type;
+    typedef RecordLess less;
+};
+
+struct radix_sorter
+{
+    template<class T>
+    static void sort(vector<T>& values, vector<T>& buffer)
+    {
+        radix_sort(values, buffer, typename key_of<T>::type());
+    }
+};
+
+struct std_sorter
+{
+    template<class T>
+    static void sort(vector<T>& values, vector<T>&)
+    {
+        std::sort(values.begin(), values.end(), typename key_of<T>::less());
+    }
+};
+
+/*
+ * Sorts count random values.
+ */
+template<class T, class Sorter>
+struct Sort
+{
+    const vector<T>& input;
+    vector<T>& values;
+    vector<T>& buffer;
+    std::size_t const count;
+
+    Sort(const vector<T>& input_, vector<T>& values_, vector<T>& buffer_, std::size_t count_)
+    :   input(input_), values(values_), buffer(buffer_), count(count_) {}
+
+    void setup()
+    {
+        values.assign(input.begin(), input.begin() + count);
+    }
+
+    std::size_t run()
+    {
+        Sorter::sort(values, buffer);
+        benchmark::do_not_optimize(values);
+        return count;
+    }
+};
+
+/*
+ * The constants of Knuth's 64 bit linear congruential generator, built from
+ * 32 bit halves as C++98 has no 64 bit literals.
+ */
+static const uint64_t MULTIPLIER = (static_cast<uint64_t>(0x5851F42DU) << 32) | 0x4C957F2DU;
+static const uint64_t INCREMENT = (static_cast<uint64_t>(0x14057B7EU) << 32) | 0xF767814FU;
+
+template<class T>
+void run(benchmark::suite& suite, const char* name)
+{
+    static declare::vector<T, MAX_SIZE> input;
+    static declare::vector<T, MAX_SIZE> values;
+    static declare::vector<T, MAX_SIZE> buffer;
+    uint64_t random = 1;
+    input.clear();
+    for (std::size_t i = 0; i < MAX_SIZE; ++i)
+    {
+        random = random * MULTIPLIER + INCREMENT;
+        input.push_back(make<T>(random));
+    }
+
+    static std::size_t const sizes[] = { 1000, 10000, 100000, MAX_SIZE };
+    for (std::size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); ++i)
+    {
+        Sort<T, radix_sorter> radix(input, values, buffer, sizes[i]);
+        suite.run(name, "estd::radix_sort", sizeof(T), sizes[i], radix);
+        Sort<T, std_sorter> sort(input, values, buffer, sizes[i]);
+        suite.run(name, "std::sort", sizeof(T), sizes[i], sort);
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    benchmark::suite suite(argc, argv);
+
+    run<uint32_t>(suite, "sort uint32_t");
+    run<uint64_t>(suite, "sort uint64_t");
+    run<Record>(suite, "sort Record by timestamp");
+
+    return suite.finish();
+}
@@ -0,0 +1,190 @@
+/**
+ * Compares estd::slot_map with an estd::vector of entities searched by
+ * their id on looking up, erasing and adding entities.
+ * \file
+ * \ingroup estl
+ * \copyright   E.S.R.Labs AG, 2014, All rights reserved.
+ */
+
+#include <estd/slot_map.h>
+#include <estd/vector.h>
+
+#include "benchmark.h"
+
+using namespace esrlabs::estd;
+
+static const std::size_t MAX_SIZE = 10000;
+static const std::size_t OPERATIONS = 1024;
+
+struct Entity
+{
+    uint32_t id;
+    uint32_t data[7];
+};
+
+static uint32_t seed = 1;
+
+static uint32_t next_random()
+{
+    seed = seed * 1103515245U + 12345U;
+    return seed >> 8;
+}
+
+static declare::slot_map<Entity, MAX_SIZE> slots;
+static uint32_t handles[MAX_SIZE];
+
+static declare::vector<Entity, MAX_SIZE> entities;
+static uint32_t ids[MAX_SIZE];
+
+struct SlotMap
+{
+    std::size_t const count;
+
+    explicit SlotMap(std::size_t count_)
+    :   count(count_)
+    {
+        slots.clear();
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            Entity& entity = slots.emplace().construct();
+            entity.id = static_cast<uint32_t>(i);
+            handles[i] = slots.handle_of(entity);
+        }
+    }
+
+    void setup() {}
+
+    std::size_t lookup()
+    {
+        uint32_t sum = 0;
+        for (std::size_t i = 0; i < OPERATIONS; ++i)
+        {
+            sum += slots.at(handles[next_random() % count]).data[0];
+        }
+        benchmark::do_not_optimize(sum);
+        return OPERATIONS;
+    }
+
+    std::size_t replace()
+    {
+        for (std::size_t i = 0; i < OPERATIONS; ++i)
+        {
+            std::size_t const index = next_random() % count;
+            Entity entity = slots.at(handles[index]);
+            slots.erase(handles[index]);
+            handles[index] = slots.insert(entity);
+        }
+        benchmark::do_not_optimize(slots);
+        return OPERATIONS;
+    }
+};
+
+/*
+ * The entities in a vector, identified by an id that is searched for on
+ * every access, as the positions change when entities are erased.
+ */
+struct Vector
+{
+    std::size_t const count;
+    uint32_t nextId;
+
+    explicit Vector(std::size_t count_)
+    :   count(count_), nextId(0)
+    {
+        entities.clear();
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            Entity& entity = entities.push_back();
+            entity.id = nextId;
+            ids[i] = nextId;
+            ++nextId;
+        }
+    }
+
+    void setup() {}
+
+    Entity* find(uint32_t id)
+    {
+        for (Entity* entity = entities.begin(); entity != entities.end(); ++entity)
+        {
+            if (entity->id == id)
+            {
+                return entity;
+            }
+        }
+        return 0L;
+    }
+
+    std::size_t lookup()
+    {
+        uint32_t sum = 0;
+        for (std::size_t i = 0; i < OPERATIONS; ++i)
+        {
+            sum += find(ids[next_random() % count])->data[0];
+        }
+        benchmark::do_not_optimize(sum);
+        return OPERATIONS;
+    }
+
+    std::size_t replace()
+    {
+        for (std::size_t i = 0; i < OPERATIONS; ++i)
+        {
+            std::size_t const index = next_random() % count;
+            Entity* const found = find(ids[index]);
+            Entity entity = *found;
+            entities.erase(found);
+            entity.id = nextId;
+            ids[index] = nextId;
+            ++nextId;
+            entities.push_back(entity);
+        }
+        benchmark::do_not_optimize(entities);
+        return OPERATIONS;
+    }
+};
+
+template<class Entities>
+struct LookupCase
+{
+    Entities& entities;
+    explicit LookupCase(Entities& entities_) : entities(entities_) {}
+    void setup() {}
+    std::size_t run() { return entities.lookup(); }
+};
+
+template<class Entities>
+struct ReplaceCase
+{
+    Entities& entities;
+    explicit ReplaceCase(Entities& entities_) : entities(entities_) {}
+    void setup() {}
+    std::size_t run() { return entities.replace(); }
+};
+
+int main(int argc, char* argv[])
+{
+    benchmark::suite suite(argc, argv);
+
+    static std::size_t const sizes[] = { 10, 100, 1000, MAX_SIZE };
+    for (std::size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); ++i)
+    {
+        std::size_t const count = sizes[i];
+        {
+            SlotMap map(count);
+            LookupCase<SlotMap> lookup(map);
+            suite.run("look up an entity", "estd::slot_map", sizeof(Entity), count, lookup);
+            ReplaceCase<SlotMap> replace(map);
+            suite.run("erase and add an entity", "estd::slot_map", sizeof(Entity), count, replace);
+        }
+        {
+            Vector v(count);
+            LookupCase<Vector> lookup(v);
+            suite.run("look up an entity", "estd::vector", sizeof(Entity), count, lookup);
+            ReplaceCase<Vector> replace(v);
+            suite.run("erase and add an entity", "estd::vector", sizeof(Entity), count, replace);
+        }
+    }
+
+    return suite.finish();
+}
@@ -0,0 +1,153 @@
+/**
+ * Measures throughput and round trip latency of estd::spsc_queue between
+ * two pinned threads and compares it with a mutex protected estd::deque.
+ * \file
+ * \ingroup estl
+ * \copyright   E.S.R.Labs AG, 2014, All rights reserved.
+ */
+
+#include <estd/spsc_queue.h>
+
+#include "benchmark.h"
+#include "threads.h"
+
+using namespace esrlabs::estd;
+
+static const std::size_t CAPACITY = 1024;
+static const std::size_t OPERATIONS = 1000000;
+static const std::size_t BATCH = 16;
+
+/*
+ * One thread pushes OPERATIONS values one by one or in batches while a
+ * second thread pops them.
+ */
+template<class Queue>
+struct Throughput
+{
+    Queue queue;
+    bool const batched;
+
+    explicit Throughput(bool batched_) : queue(), batched(batched_) {}
+
+    static void* consume(void* arg)
+    {
+        Throughput& self = *static_cast<Throughput*>(arg);
+        benchmark::pin(1);
+        uint32_t values[BATCH];
+        uint32_t spins = 0;
+        std::size_t received = 0;
+        while (received < OPERATIONS)
+        {
+            std::size_t const n = self.batched
+                ? self.queue.try_pop_n(values, BATCH)
+                : (self.queue.try_pop(values[0]) ? 1 : 0);
+            if (n == 0)
+            {
+                benchmark::backoff(spins);
+            }
+            received += n;
+        }
+        return 0L;
+    }
+
+    void setup() {}
+
+    std::size_t run()
+    {
+        pthread_t consumer;
+        pthread_create(&consumer, 0L, &consume, this);
+        uint32_t values[BATCH] = { 0 };
+        uint32_t spins = 0;
+        std::size_t sent = 0;
+        while (sent < OPERATIONS)
+        {
+            std::size_t const n = batched
+                ? queue.try_push_n(values, std::min(BATCH, OPERATIONS - sent))
+                : (queue.try_push(values[0]) ? 1 : 0);
+            if (n == 0)
+            {
+                benchmark::backoff(spins);
+            }
+            sent += n;
+        }
+        pthread_join(consumer, 0L);
+        return OPERATIONS;
+    }
+};
+
+/*
+ * Sends a value to the second thread and waits for it to come back.
+ */
+template<class Queue>
+struct RoundTrip
+{
+    static const std::size_t ROUND_TRIPS = 100000;
+
+    Queue ping;
+    Queue pong;
+
+    static void* echo(void* arg)
+    {
+        RoundTrip& self = *static_cast<RoundTrip*>(arg);
+        benchmark::pin(1);
+        uint32_t spins = 0;
+        for (std::size_t i = 0; i < ROUND_TRIPS; ++i)
+        {
+            uint32_t value;
+            while (!self.ping.try_pop(value))
+            {
+                benchmark::backoff(spins);
+            }
+            while (!self.pong.try_push(value))
+            {
+                benchmark::backoff(spins);
+            }
+        }
+        return 0L;
+    }
+
+    void setup() {}
+
+    std::size_t run()
+    {
+        pthread_t echoer;
+        pthread_create(&echoer, 0L, &echo, this);
+        uint32_t spins = 0;
+        for (std::size_t i = 0; i < ROUND_TRIPS; ++i)
+        {
+            uint32_t value = static_cast<uint32_t>(i);
+            while (!ping.try_push(value))
+            {
+                benchmark::backoff(spins);
+            }
+            while (!pong.try_pop(value))
+            {
+                benchmark::backoff(spins);
+            }
+        }
+        pthread_join(echoer, 0L);
+        return ROUND_TRIPS;
+    }
+};
+
+template<class Queue>
+void run(benchmark::suite& suite, const char* name)
+{
+    static Throughput<Queue> single(false);
+    suite.run("throughput", name, sizeof(uint32_t), CAPACITY, single);
+    static Throughput<Queue> batched(true);
+    suite.run("throughput batched", name, sizeof(uint32_t), CAPACITY, batched);
+    static RoundTrip<Queue> roundTrip;
+    suite.run("round trip", name, sizeof(uint32_t), CAPACITY, roundTrip);
+}
+
+int main(int argc, char* argv[])
+{
+    benchmark::suite suite(argc, argv);
+    benchmark::pin(0);
+
+    run<declare::spsc_queue<uint32_t, CAPACITY> >(suite, "estd::spsc_queue");
+    run<benchmark::locked_queue<uint32_t, CAPACITY> >(suite, "mutex + estd::deque");
+
+    return suite.finish();
+}
@@ -0,0 +1,145 @@
+/**
+ * Compares estd::stable_sort and estd::inplace_merge, with and without a
+ * buffer, with std::stable_sort and std::inplace_merge on event records.
+ * \file
+ * \ingroup estl
+ * \copyright   E.S.R.Labs AG, 2014, All rights reserved.
+ */
+
+#include <algorithm>
+
+#include <estd/algorithm.h>
+#include <estd/vector.h>
+
+#include "benchmark.h"
+
+using namespace esrlabs::estd;
+
+static const std::size_t MAX_SIZE = 100000;
+
+struct Event
+{
+    uint32_t timestamp;
+    uint32_t source;
+    uint32_t data[2];
+};
+
+struct EventLess
+{
+    bool operator()(const Event& a, const Event& b) const { return a.timestamp < b.timestamp; }
+};
+
+enum Sorter
+{
+    ESTD,
+    ESTD_BUFFER,
+    STD
+};
+
+static declare::vector<Event, MAX_SIZE> input;
+static declare::vector<Event, MAX_SIZE> values;
+static declare::vector<Event, MAX_SIZE / 2> buffer;
+
+/*
+ * Sorts count events, whose timestamps have many duplicates.
+ */
+struct Sort
+{
+    Sorter const sorter;
+    std::size_t const count;
+
+    Sort(Sorter sorter_, std::size_t count_) : sorter(sorter_), count(count_) {}
+
+    void setup()
+    {
+        values.assign(input.begin(), input.begin() + count);
+    }
+
+    std::size_t run()
+    {
+        switch (sorter)
+        {
+        case ESTD:
+            stable_sort(values.begin(), values.end(), EventLess());
+            break;
+        case ESTD_BUFFER:
+            stable_sort(values.begin(), values.end(), buffer, EventLess());
+            break;
+        default:
+            std::stable_sort(values.begin(), values.end(), EventLess());
+            break;
+        }
+        benchmark::do_not_optimize(values);
+        return count;
+    }
+};
+
+/*
+ * Merges two sorted halves of count events.
+ */
+struct Merge
+{
+    Sorter const sorter;
+    std::size_t const count;
+
+    Merge(Sorter sorter_, std::size_t count_) : sorter(sorter_), count(count_) {}
+
+    void setup()
+    {
+        values.assign(input.begin(), input.begin() + count);
+        std::sort(values.begin(), values.begin() + count / 2, EventLess());
+        std::sort(values.begin() + count / 2, values.end(), EventLess());
+    }
+
+    std::size_t run()
+    {
+        vector<Event>::iterator const middle = values.begin() + count / 2;
+        switch (sorter)
+        {
+        case ESTD:
+            inplace_merge(values.begin(), middle, values.end(), EventLess());
+            break;
+        case ESTD_BUFFER:
+            inplace_merge(values.begin(), middle, values.end(), buffer, EventLess());
+            break;
+        default:
+            std::inplace_merge(values.begin(), middle, values.end(), EventLess());
+            break;
+        }
+        benchmark::do_not_optimize(values);
+        return count;
+    }
+};
+
+template<class Case>
+void run(benchmark::suite& suite, const char* name, std::size_t count)
+{
+    Case estd(ESTD, count);
+    suite.run(name, "estd", sizeof(Event), count, estd);
+    Case estdBuffer(ESTD_BUFFER, count);
+    suite.run(name, "estd with buffer", sizeof(Event), count, estdBuffer);
+    Case std(STD, count);
+    suite.run(name, "std", sizeof(Event), count, std);
+}
+
+int main(int argc, char* argv[])
+{
+    benchmark::suite suite(argc, argv);
+
+    uint32_t random = 1;
+    for (std::size_t i = 0; i < MAX_SIZE; ++i)
+    {
+        random = random * 1103515245U + 12345U;
+        Event const e = { (random >> 16) % 1024, static_cast<uint32_t>(i), { 0, 0 } };
+        input.push_back(e);
+    }
+
+    static std::size_t const sizes[] = { 1000, 10000, MAX_SIZE };
+    for (std::size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); ++i)
+    {
+        run<Sort>(suite, "stable_sort (per element)", sizes[i]);
+        run<Merge>(suite, "inplace_merge (per element)", sizes[i]);
+    }
+
+    return suite.finish();
+}
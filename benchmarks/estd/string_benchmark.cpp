@@ -0,0 +1,210 @@
+/**
+ * Compares estd::string with snprintf and std::string on building log
+ * lines, searching and comparing.
+ * \file
+ * \ingroup estl
+ * \copyright   E.S.R.Labs AG, 2014, All rights reserved.
+ */
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#include <estd/string.h>
+
+#include "benchmark.h"
+
+using namespace esrlabs::estd;
+
+static const std::size_t CAPACITY = 128;
+static const std::size_t COUNT = 1024;
+
+struct Sample
+{
+    uint32_t id;
+    int32_t value;
+    uint32_t flags;
+    int32_t temperature;
+};
+
+static Sample samples[COUNT];
+
+enum Formatter
+{
+    ESTD,
+    SNPRINTF,
+    STD
+};
+
+/*
+ * Formats a log line with text, decimal, hexadecimal and fixed point
+ * numbers for each of COUNT samples.
+ */
+struct Format
+{
+    Formatter const formatter;
+
+    explicit Format(Formatter formatter_) : formatter(formatter_) {}
+
+    void setup() {}
+
+    std::size_t run()
+    {
+        std::size_t length = 0;
+        for (std::size_t i = 0; i < COUNT; ++i)
+        {
+            Sample const& s = samples[i];
+            switch (formatter)
+            {
+            case ESTD:
+            {
+                declare::string<CAPACITY> line;
+                line.append("sample id=").append_dec(s.id)
+                    .append(" value=").append_dec(s.value)
+                    .append(" flags=0x").append_hex(s.flags, 8)
+                    .append(" temperature=").append_fixed(s.temperature, 2);
+                benchmark::do_not_optimize(line);
+                length += line.size();
+                break;
+            }
+            case SNPRINTF:
+            {
+                char line[CAPACITY + 1];
+                int32_t const t = (s.temperature < 0) ? -s.temperature : s.temperature;
+                int const n = ::snprintf(line, sizeof(line),
+                    "sample id=%u value=%d flags=0x%08x temperature=%s%d.%02d",
+                    static_cast<unsigned>(s.id), static_cast<int>(s.value),
+                    static_cast<unsigned>(s.flags), (s.temperature < 0) ? "-" : "",
+                    static_cast<int>(t / 100), static_cast<int>(t % 100));
+                benchmark::do_not_optimize(line);
+                length += static_cast<std::size_t>(n);
+                break;
+            }
+            default:
+            {
+#if __cplusplus >= 201103L
+                int32_t const t = (s.temperature < 0) ? -s.temperature : s.temperature;
+                std::string const fraction = std::to_string(t % 100);
+                std::string line;
+                line.reserve(CAPACITY);
+                line += "sample id=";
+                line += std::to_string(s.id);
+                line += " value=";
+                line += std::to_string(s.value);
+                line += " flags=0x";
+                char hex[9];
+                ::snprintf(hex, sizeof(hex), "%08x", static_cast<unsigned>(s.flags));
+                line += hex;
+                line += " temperature=";
+                if (s.temperature < 0)
+                {
+                    line += '-';
+                }
+                line += std::to_string(t / 100);
+                line += (fraction.size() < 2) ? ".0" : ".";
+                line += fraction;
+                benchmark::do_not_optimize(line);
+                length += line.size();
+#endif
+                break;
+            }
+            }
+        }
+        benchmark::do_not_optimize(length);
+        return COUNT;
+    }
+};
+
+/*
+ * Searches a word, which occurs at the end of a line of CAPACITY
+ * characters, and compares two equal lines.
+ */
+template<class String>
+struct Search
+{
+    String const& line;
+    String const& other;
+
+    Search(String const& line_, String const& other_) : line(line_), other(other_) {}
+
+    void setup() {}
+
+    std::size_t run()
+    {
+        std::size_t found = 0;
+        for (std::size_t i = 0; i < COUNT; ++i)
+        {
+            found += line.find("needle");
+            found += line.find(':');
+            found += (line == other) ? 1 : 0;
+        }
+        benchmark::do_not_optimize(found);
+        return COUNT;
+    }
+};
+
+/*
+ * Searches with strstr, strchr and strcmp.
+ */
+struct SearchC
+{
+    const char* const line;
+    const char* const other;
+
+    SearchC(const char* line_, const char* other_) : line(line_), other(other_) {}
+
+    void setup() {}
+
+    std::size_t run()
+    {
+        std::size_t found = 0;
+        for (std::size_t i = 0; i < COUNT; ++i)
+        {
+            found += static_cast<std::size_t>(std::strstr(line, "needle") - line);
+            found += static_cast<std::size_t>(std::strchr(line, ':') - line);
+            found += (std::strcmp(line, other) == 0) ? 1 : 0;
+        }
+        benchmark::do_not_optimize(found);
+        return COUNT;
+    }
+};
+
+int main(int argc, char* argv[])
+{
+    benchmark::suite suite(argc, argv);
+
+    uint32_t random = 1;
+    for (std::size_t i = 0; i < COUNT; ++i)
+    {
+        random = random * 1103515245U + 12345U;
+        Sample const s = {
+            static_cast<uint32_t>(i),
+            static_cast<int32_t>(random) >> (random % 24),
+            random,
+            static_cast<int32_t>(random % 10000) - 4000 };
+        samples[i] = s;
+    }
+
+    Format estdFormat(ESTD);
+    suite.run("format log line", "estd::string", 1, CAPACITY, estdFormat);
+    Format snprintfFormat(SNPRINTF);
+    suite.run("format log line", "snprintf", 1, CAPACITY, snprintfFormat);
+#if __cplusplus >= 201103L
+    Format stdFormat(STD);
+    suite.run("format log line", "std::string", 1, CAPACITY, stdFormat);
+#endif
+
+    declare::string<CAPACITY> line;
+    line.assign(CAPACITY - 7, 'a').append(":needle");
+    declare::string<CAPACITY> other(line);
+    Search<string> estdSearch(line, other);
+    suite.run("find and compare", "estd::string", 1, CAPACITY, estdSearch);
+    std::string const stdLine(line.c_str());
+    std::string const stdOther(other.c_str());
+    Search<std::string> stdSearch(stdLine, stdOther);
+    suite.run("find and compare", "std::string", 1, CAPACITY, stdSearch);
+    SearchC cSearch(line.c_str(), other.c_str());
+    suite.run("find and compare", "strstr", 1, CAPACITY, cSearch);
+
+    return suite.finish();
+}
@@ -0,0 +1,120 @@
+/**
+ * Helpers for the benchmarks of the concurrent containers.
+ * \file
+ * \ingroup estl
+ * \copyright   E.S.R.Labs AG, 2014, All rights reserved.
+ */
+#ifndef ESTD_BENCHMARK_THREADS_H
+#define ESTD_BENCHMARK_THREADS_H
+
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+
+#include <estd/deque.h>
+
+namespace esrlabs {
+namespace estd {
+namespace benchmark {
+
+/*
+ * Pins the calling thread to the given CPU if the system has it.
+ */
+inline void pin(int cpu)
+{
+#ifdef __linux__
+    if (cpu < sysconf(_SC_NPROCESSORS_ONLN))
+    {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(cpu, &set);
+        (void)pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+    }
+#else
+    (void)cpu;
+#endif
+}
+
+/*
+ * Busy waits but yields regularly, so the benchmark also completes on
+ * machines with a single core.
+ */
+inline void backoff(uint32_t& spins)
+{
+    if (++spins > 64)
+    {
+        spins = 0;
+        sched_yield();
+    }
+}
+
+/*
+ * The baseline: a deque protected by a mutex.
+ */
+template<class T, std::size_t N>
+class locked_queue
+{
+public:
+    locked_queue() { pthread_mutex_init(&_mutex, 0L); }
+    ~locked_queue() { pthread_mutex_destroy(&_mutex); }
+
+    bool try_push(const T& value)
+    {
+        pthread_mutex_lock(&_mutex);
+        bool const pushed = !_fifo.full();
+        if (pushed)
+        {
+            _fifo.push_back(value);
+        }
+        pthread_mutex_unlock(&_mutex);
+        return pushed;
+    }
+
+    std::size_t try_push_n(const T* values, std::size_t n)
+    {
+        pthread_mutex_lock(&_mutex);
+        std::size_t i = 0;
+        for (; (i < n) && !_fifo.full(); ++i)
+        {
+            _fifo.push_back(values[i]);
+        }
+        pthread_mutex_unlock(&_mutex);
+        return i;
+    }
+
+    bool try_pop(T& value)
+    {
+        pthread_mutex_lock(&_mutex);
+        bool const popped = !_fifo.empty();
+        if (popped)
+        {
+            value = _fifo.front();
+            _fifo.pop_front();
+        }
+        pthread_mutex_unlock(&_mutex);
+        return popped;
+    }
+
+    std::size_t try_pop_n(T* values, std::size_t n)
+    {
+        pthread_mutex_lock(&_mutex);
+        std::size_t i = 0;
+        for (; (i < n) && !_fifo.empty(); ++i)
+        {
+            values[i] = _fifo.front();
+            _fifo.pop_front();
+        }
+        pthread_mutex_unlock(&_mutex);
+        return i;
+    }
+
+private:
+    pthread_mutex_t _mutex;
+    declare::deque<T, N> _fifo;
+};
+
+} /* namespace benchmark */
+} /* namespace estd */
+} /* namespace esrlabs */
+
+#endif /* ESTD_BENCHMARK_THREADS_H */
@@ -0,0 +1,221 @@
+/**
+ * Compares estd::timer_wheel with a sorted estd::vector of deadlines on
+ * restarting and expiring timeouts while up to 100000 timers are running.
+ * \file
+ * \ingroup estl
+ * \copyright   E.S.R.Labs AG, 2014, All rights reserved.
+ */
+
+#include <algorithm>
+
+#include <estd/timer_wheel.h>
+#include <estd/vector.h>
+
+#include "benchmark.h"
+
+using namespace esrlabs::estd;
+
+static const std::size_t MAX_SIZE = 100000;
+static const std::size_t OPERATIONS = 1024;
+
+typedef timer_wheel::tick_type tick_type;
+
+static uint32_t seed = 1;
+
+static uint32_t next_random()
+{
+    seed = seed * 1103515245U + 12345U;
+    return seed >> 8;
+}
+
+/*
+ * A random delay of 4 * count ticks on average, so a timer expires every
+ * fourth tick.
+ */
+static tick_type delay_for(std::size_t count)
+{
+    return 1U + next_random() % static_cast<tick_type>(8U * count);
+}
+
+typedef declare::timer_wheel<256, MAX_SIZE> Wheel;
+
+static Wheel wheel;
+static std::size_t handles[MAX_SIZE];
+
+struct Restart
+{
+    void operator()(std::size_t timer, void*) const
+    {
+        wheel.restart(timer, delay_for(count));
+    }
+
+    std::size_t count;
+};
+
+struct TimerWheel
+{
+    std::size_t const count;
+
+    explicit TimerWheel(std::size_t count_)
+    :   count(count_)
+    {
+        wheel.clear();
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            handles[i] = wheel.start(delay_for(count));
+        }
+    }
+
+    void setup() {}
+
+    std::size_t restart()
+    {
+        for (std::size_t i = 0; i < OPERATIONS; ++i)
+        {
+            wheel.restart(handles[next_random() % count], delay_for(count));
+        }
+        benchmark::do_not_optimize(wheel);
+        return OPERATIONS;
+    }
+
+    std::size_t expire()
+    {
+        Restart const restart = { count };
+        std::size_t expired = 0;
+        while (expired < OPERATIONS)
+        {
+            expired += wheel.advance(wheel.now() + 1U, restart);
+        }
+        return expired;
+    }
+};
+
+struct Deadline
+{
+    tick_type expires;
+    uint32_t id;
+};
+
+/*
+ * Latest deadline first, so the next timer to expire is at the back.
+ */
+struct Later
+{
+    bool operator()(const Deadline& a, const Deadline& b) const
+    {
+        return (a.expires > b.expires) || ((a.expires == b.expires) && (a.id > b.id));
+    }
+};
+
+static declare::vector<Deadline, MAX_SIZE> deadlines;
+static tick_type expires[MAX_SIZE];
+
+/*
+ * The deadlines sorted in a vector, which moves half of the vector on
+ * average whenever a timer is restarted.
+ */
+struct SortedVector
+{
+    std::size_t const count;
+    tick_type now;
+
+    explicit SortedVector(std::size_t count_)
+    :   count(count_), now(0)
+    {
+        deadlines.clear();
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            expires[i] = delay_for(count);
+            Deadline const deadline = { expires[i], static_cast<uint32_t>(i) };
+            deadlines.push_back(deadline);
+        }
+        std::sort(deadlines.begin(), deadlines.end(), Later());
+    }
+
+    void setup() {}
+
+    void start(uint32_t id, tick_type delay)
+    {
+        expires[id] = now + delay;
+        Deadline const deadline = { expires[id], id };
+        deadlines.insert(
+            std::upper_bound(deadlines.begin(), deadlines.end(), deadline, Later()),
+            deadline);
+    }
+
+    std::size_t restart()
+    {
+        for (std::size_t i = 0; i < OPERATIONS; ++i)
+        {
+            uint32_t const id = static_cast<uint32_t>(next_random() % count);
+            Deadline const deadline = { expires[id], id };
+            deadlines.erase(
+                std::lower_bound(deadlines.begin(), deadlines.end(), deadline, Later()));
+            start(id, delay_for(count));
+        }
+        benchmark::do_not_optimize(deadlines);
+        return OPERATIONS;
+    }
+
+    std::size_t expire()
+    {
+        std::size_t expired = 0;
+        while (expired < OPERATIONS)
+        {
+            ++now;
+            while (deadlines.back().expires <= now)
+            {
+                uint32_t const id = deadlines.back().id;
+                deadlines.pop_back();
+                start(id, delay_for(count));
+                ++expired;
+            }
+        }
+        return expired;
+    }
+};
+
+template<class Timers>
+struct RestartCase
+{
+    Timers& timers;
+    explicit RestartCase(Timers& timers_) : timers(timers_) {}
+    void setup() {}
+    std::size_t run() { return timers.restart(); }
+};
+
+template<class Timers>
+struct ExpireCase
+{
+    Timers& timers;
+    explicit ExpireCase(Timers& timers_) : timers(timers_) {}
+    void setup() {}
+    std::size_t run() { return timers.expire(); }
+};
+
+int main(int argc, char* argv[])
+{
+    benchmark::suite suite(argc, argv);
+
+    static std::size_t const sizes[] = { 1000, 10000, MAX_SIZE };
+    for (std::size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); ++i)
+    {
+        std::size_t const count = sizes[i];
+        {
+            TimerWheel timers(count);
+            RestartCase<TimerWheel> restart(timers);
+            suite.run("restart a timer", "estd::timer_wheel", sizeof(std::size_t), count, restart);
+            ExpireCase<TimerWheel> expire(timers);
+            suite.run("expire and restart a timer", "estd::timer_wheel", sizeof(std::size_t), count, expire);
+        }
+        {
+            SortedVector timers(count);
+            RestartCase<SortedVector> restart(timers);
+            suite.run("restart a timer", "sorted estd::vector", sizeof(Deadline), count, restart);
+            ExpireCase<SortedVector> expire(timers);
+            suite.run("expire and restart a timer", "sorted estd::vector", sizeof(Deadline), count, expire);
+        }
+    }
+
+    return suite.finish();
+}
@@ -0,0 +1,178 @@
+/**
+ * Compares insertion into and lookups in estd::unordered_map with
+ * std::unordered_map and a linear search in an estd::vector of pairs.
+ * \file
+ * \ingroup estl
+ * \copyright   E.S.R.Labs AG, 2014, All rights reserved.
+ */
+
+#include <algorithm>
+#if __cplusplus >= 201103L
+#include <unordered_map>
+#endif
+
+#include <estd/unordered_map.h>
+#include <estd/vector.h>
+
+#include "benchmark.h"
+
+using namespace esrlabs::estd;
+
+static const std::size_t LOOKUPS = 4096;
+
+/*
+ * Scattered 29 bit identifiers, like extended CAN identifiers.
+ */
+static uint32_t key(std::size_t i)
+{
+    return (static_cast<uint32_t>(i) * 2654435761U) & 0x1FFFFFFFU;
+}
+
+template<class T>
+struct pair_key
+{
+    uint32_t const _key;
+
+    explicit pair_key(uint32_t k) : _key(k) {}
+
+    bool operator()(const T& p) const { return p.first == _key; }
+};
+
+template<class V>
+void insert(vector<std::pair<uint32_t, V> >& v, uint32_t k, const V& value)
+{
+    v.push_back(std::make_pair(k, value));
+}
+
+template<class V>
+bool contains(vector<std::pair<uint32_t, V> >& v, uint32_t k)
+{
+    return std::find_if(v.begin(), v.end(), pair_key<std::pair<uint32_t, V> >(k)) != v.end();
+}
+
+template<class V>
+void insert(unordered_map<uint32_t, V>& m, uint32_t k, const V& value)
+{
+    (void)m.insert(std::make_pair(k, value));
+}
+
+template<class V>
+bool contains(unordered_map<uint32_t, V>& m, uint32_t k)
+{
+    return m.find(k) != m.end();
+}
+
+#if __cplusplus >= 201103L
+template<class V>
+void insert(std::unordered_map<uint32_t, V>& m, uint32_t k, const V& value)
+{
+    (void)m.insert(std::make_pair(k, value));
+}
+
+template<class V>
+bool contains(std::unordered_map<uint32_t, V>& m, uint32_t k)
+{
+    return m.find(k) != m.end();
+}
+#endif
+
+/*
+ * Inserts count keys into an empty container.
+ */
+template<class Container>
+struct Insert
+{
+    Container& container;
+    std::size_t const count;
+
+    Insert(Container& container_, std::size_t count_) : container(container_), count(count_) {}
+
+    void setup()
+    {
+        container.clear();
+    }
+
+    std::size_t run()
+    {
+        uint32_t const value = 0;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            insert(container, key(i), value);
+        }
+        benchmark::do_not_optimize(container);
+        return count;
+    }
+};
+
+/*
+ * Looks up keys of a container filled with count keys. Every second key
+ * is missing if hits is false.
+ */
+template<class Container>
+struct Lookup
+{
+    Container& container;
+    std::size_t const count;
+    bool const hits;
+
+    Lookup(Container& container_, std::size_t count_, bool hits_)
+    :   container(container_), count(count_), hits(hits_) {}
+
+    void setup()
+    {
+        container.clear();
+        uint32_t const value = 0;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            insert(container, key(i), value);
+        }
+    }
+
+    std::size_t run()
+    {
+        std::size_t found = 0;
+        for (std::size_t i = 0; i < LOOKUPS; ++i)
+        {
+            // visit the keys in a different order than they were inserted
+            std::size_t const k = (i * 7919) % count;
+            bool const miss = !hits && ((i & 1) != 0);
+            found += contains(container, key(miss ? (count + k) : k)) ? 1 : 0;
+        }
+        benchmark::do_not_optimize(found);
+        return LOOKUPS;
+    }
+};
+
+template<class Container>
+void run(benchmark::suite& suite, const char* name, std::size_t count)
+{
+    static Container container;
+    Insert<Container> insert(container, count);
+    suite.run("insert", name, sizeof(uint32_t), count, insert);
+    Lookup<Container> hit(container, count, true);
+    suite.run("find hit", name, sizeof(uint32_t), count, hit);
+    Lookup<Container> miss(container, count, false);
+    suite.run("find 50% miss", name, sizeof(uint32_t), count, miss);
+}
+
+template<std::size_t N>
+void run(benchmark::suite& suite)
+{
+    run<declare::unordered_map<uint32_t, uint32_t, N> >(suite, "estd::unordered_map", N);
+    run<declare::vector<std::pair<uint32_t, uint32_t>, N> >(suite, "estd::vector<pair>", N);
+#if __cplusplus >= 201103L
+    run<std::unordered_map<uint32_t, uint32_t> >(suite, "std::unordered_map", N);
+#endif
+}
+
+int main(int argc, char* argv[])
+{
+    benchmark::suite suite(argc, argv);
+
+    run<16>(suite);
+    run<64>(suite);
+    run<256>(suite);
+    run<1024>(suite);
+
+    return suite.finish();
+}
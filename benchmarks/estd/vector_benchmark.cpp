@@ -0,0 +1,319 @@
+/**
+ * Compares estd::vector with std::vector for the common operations over
+ * a range of element sizes and capacities.
+ * \file
+ * \ingroup estl
+ * \copyright   E.S.R.Labs AG, 2014, All rights reserved.
+ */
+
+#include <algorithm>
+#include <vector>
+
+#include <estd/vector.h>
+
+#include "benchmark.h"
+
+using namespace esrlabs::estd;
+
+/*
+ * Helpers that hide the differences between the two vector types.
+ */
+template<class T>
+void prepare(std::vector<T>& v, std::size_t capacity)
+{
+    v.clear();
+    v.reserve(capacity);
+}
+
+template<class T>
+void prepare(vector<T>& v, std::size_t)
+{
+    v.clear();
+}
+
+template<class T>
+void emplace_back(std::vector<T>& v, const T& value)
+{
+#if __cplusplus >= 201103L
+    v.emplace_back(value);
+#else
+    v.push_back(value);
+#endif
+}
+
+template<class T>
+void emplace_back(vector<T>& v, const T& value)
+{
+    v.emplace_back().construct(value);
+}
+
+template<class Vector>
+Vector& instance(int id)
+{
+    static Vector first;
+    static Vector second;
+    return (id == 0) ? first : second;
+}
+
+template<class Vector>
+void populate(Vector& v, std::size_t capacity, std::size_t n)
+{
+    typedef typename Vector::value_type T;
+    prepare(v, capacity);
+    T value;
+    memset(&value, 0x5A, sizeof(T));
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        v.push_back(value);
+    }
+}
+
+/*
+ * Maximum number of inserts or erases done at the front or in the middle,
+ * keeps the quadratic cases bounded for large capacities.
+ */
+static const std::size_t MAX_SHIFTS = 64;
+
+/*
+ * Benchmark cases. Each case works on a vector of the given capacity.
+ */
+template<class Vector>
+struct PushBack
+{
+    Vector& v;
+    std::size_t const capacity;
+
+    PushBack(Vector& v_, std::size_t capacity_) : v(v_), capacity(capacity_) {}
+
+    void setup()
+    {
+        prepare(v, capacity);
+    }
+
+    std::size_t run()
+    {
+        typename Vector::value_type value = typename Vector::value_type();
+        for (std::size_t i = 0; i < capacity; ++i)
+        {
+            v.push_back(value);
+        }
+        benchmark::do_not_optimize(v);
+        return capacity;
+    }
+};
+
+template<class Vector>
+struct EmplaceBack
+{
+    Vector& v;
+    std::size_t const capacity;
+
+    EmplaceBack(Vector& v_, std::size_t capacity_) : v(v_), capacity(capacity_) {}
+
+    void setup()
+    {
+        prepare(v, capacity);
+    }
+
+    std::size_t run()
+    {
+        typename Vector::value_type value = typename Vector::value_type();
+        for (std::size_t i = 0; i < capacity; ++i)
+        {
+            emplace_back(v, value);
+        }
+        benchmark::do_not_optimize(v);
+        return capacity;
+    }
+};
+
+template<class Vector>
+struct Insert
+{
+    Vector& v;
+    std::size_t const capacity;
+    bool const middle;
+    std::size_t const count;
+
+    Insert(Vector& v_, std::size_t capacity_, bool middle_)
+    :   v(v_)
+    ,   capacity(capacity_)
+    ,   middle(middle_)
+    ,   count(std::min(capacity_ / 2, MAX_SHIFTS))
+    {}
+
+    void setup()
+    {
+        populate(v, capacity, capacity - count);
+    }
+
+    std::size_t run()
+    {
+        typename Vector::value_type value = typename Vector::value_type();
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            v.insert(v.begin() + (middle ? v.size() / 2 : 0), value);
+        }
+        benchmark::do_not_optimize(v);
+        return count;
+    }
+};
+
+template<class Vector>
+struct Erase
+{
+    Vector& v;
+    std::size_t const capacity;
+    std::size_t const count;
+
+    Erase(Vector& v_, std::size_t capacity_)
+    :   v(v_)
+    ,   capacity(capacity_)
+    ,   count(std::min(capacity_, MAX_SHIFTS))
+    {}
+
+    void setup()
+    {
+        populate(v, capacity, capacity);
+    }
+
+    std::size_t run()
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            v.erase(v.begin());
+        }
+        benchmark::do_not_optimize(v);
+        return count;
+    }
+};
+
+template<class Vector>
+struct Clear
+{
+    Vector& v;
+    std::size_t const capacity;
+
+    Clear(Vector& v_, std::size_t capacity_) : v(v_), capacity(capacity_) {}
+
+    void setup()
+    {
+        populate(v, capacity, capacity);
+    }
+
+    std::size_t run()
+    {
+        v.clear();
+        benchmark::do_not_optimize(v);
+        return 1;
+    }
+};
+
+template<class Vector>
+struct Assign
+{
+    Vector& source;
+    Vector& target;
+    std::size_t const capacity;
+
+    Assign(Vector& source_, Vector& target_, std::size_t capacity_)
+    :   source(source_)
+    ,   target(target_)
+    ,   capacity(capacity_)
+    {}
+
+    void setup()
+    {
+        populate(source, capacity, capacity);
+        prepare(target, capacity);
+    }
+
+    std::size_t run()
+    {
+        target = source;
+        benchmark::do_not_optimize(target);
+        return 1;
+    }
+};
+
+template<class Vector>
+struct Iterate
+{
+    Vector& v;
+    std::size_t const capacity;
+
+    Iterate(Vector& v_, std::size_t capacity_) : v(v_), capacity(capacity_) {}
+
+    void setup()
+    {
+        populate(v, capacity, capacity);
+    }
+
+    std::size_t run()
+    {
+        uint32_t sum = 0;
+        for (typename Vector::const_iterator i = v.begin(); i != v.end(); ++i)
+        {
+            sum += i->data[0];
+        }
+        benchmark::do_not_optimize(sum);
+        return capacity;
+    }
+};
+
+template<class Vector>
+void run(benchmark::suite& suite, const char* name, std::size_t capacity)
+{
+    Vector& v = instance<Vector>(0);
+    std::size_t const size = sizeof(typename Vector::value_type);
+
+    PushBack<Vector> pushBack(v, capacity);
+    suite.run("push_back", name, size, capacity, pushBack);
+    EmplaceBack<Vector> emplaceBack(v, capacity);
+    suite.run("emplace_back", name, size, capacity, emplaceBack);
+    Insert<Vector> frontInsert(v, capacity, false);
+    suite.run("insert front", name, size, capacity, frontInsert);
+    Insert<Vector> midInsert(v, capacity, true);
+    suite.run("insert middle", name, size, capacity, midInsert);
+    Erase<Vector> erase(v, capacity);
+    suite.run("erase front", name, size, capacity, erase);
+    Clear<Vector> clear(v, capacity);
+    suite.run("clear", name, size, capacity, clear);
+    Assign<Vector> assign(v, instance<Vector>(1), capacity);
+    suite.run("operator=", name, size, capacity, assign);
+    Iterate<Vector> iterate(v, capacity);
+    suite.run("iterate", name, size, capacity, iterate);
+
+    prepare(v, capacity);
+    prepare(instance<Vector>(1), capacity);
+}
+
+template<std::size_t Size, std::size_t N>
+void run(benchmark::suite& suite)
+{
+    typedef benchmark::payload<Size> T;
+    run<declare::vector<T, N> >(suite, "estd::vector", N);
+    run<std::vector<T> >(suite, "std::vector", N);
+}
+
+template<std::size_t Size>
+void run(benchmark::suite& suite)
+{
+    run<Size, 16>(suite);
+    run<Size, 256>(suite);
+    run<Size, 4096>(suite);
+    run<Size, 65536>(suite);
+}
+
+int main(int argc, char* argv[])
+{
+    benchmark::suite suite(argc, argv);
+
+    run<1>(suite);
+    run<4>(suite);
+    run<16>(suite);
+    run<64>(suite);
+    run<256>(suite);
+
+    return suite.finish();
+}
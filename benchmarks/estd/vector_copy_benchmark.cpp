@@ -0,0 +1,154 @@
+/**
+ * Compares the memcpy/memset based copy and fill paths of estd::vector
+ * for trivially copyable types with the element-wise paths.
+ * \file
+ * \ingroup estl
+ * \copyright   E.S.R.Labs AG, 2014, All rights reserved.
+ */
+
+#include <estd/vector.h>
+
+#include "benchmark.h"
+
+using namespace esrlabs::estd;
+
+/*
+ * Has the same layout as benchmark::payload but a user provided copy constructor, so
+ * estd::vector has to copy it element by element.
+ */
+template<std::size_t Size>
+struct Wrapped
+{
+    Wrapped() : value() {}
+    Wrapped(const Wrapped& other) : value(other.value) {}
+    Wrapped& operator=(const Wrapped& other) { value = other.value; return *this; }
+
+    benchmark::payload<Size> value;
+};
+
+static const std::size_t SIZE = 4096;
+
+template<class T>
+struct AssignOperator
+{
+    declare::vector<T, SIZE> source;
+    declare::vector<T, SIZE> target;
+
+    AssignOperator() : source(SIZE, T()), target() {}
+
+    void setup() {}
+
+    std::size_t run()
+    {
+        target = source;
+        benchmark::do_not_optimize(target);
+        return 1;
+    }
+};
+
+template<class T>
+struct CopyConstruct
+{
+    declare::vector<T, SIZE> source;
+
+    CopyConstruct() : source(SIZE, T()) {}
+
+    void setup() {}
+
+    std::size_t run()
+    {
+        declare::vector<T, SIZE> target(source);
+        benchmark::do_not_optimize(target);
+        return 1;
+    }
+};
+
+template<class T>
+struct AssignFill
+{
+    declare::vector<T, SIZE> target;
+
+    void setup() {}
+
+    std::size_t run()
+    {
+        target.assign(SIZE, T());
+        benchmark::do_not_optimize(target);
+        return 1;
+    }
+};
+
+template<class T>
+struct InsertFill
+{
+    declare::vector<T, SIZE> target;
+
+    void setup()
+    {
+        target.clear();
+    }
+
+    std::size_t run()
+    {
+        target.insert(target.cbegin(), SIZE, T());
+        benchmark::do_not_optimize(target);
+        return 1;
+    }
+};
+
+template<class T>
+struct RangeInsert
+{
+    static const std::size_t CHUNK = 128;
+
+    declare::vector<T, SIZE> target;
+    T chunk[CHUNK];
+
+    RangeInsert() : target(SIZE - CHUNK, T()) {}
+
+    void setup()
+    {
+        target.erase(target.cbegin() + SIZE - CHUNK, target.cend());
+    }
+
+    std::size_t run()
+    {
+        // insert a chunk into the middle of the vector
+        target.insert(target.cbegin() + target.size() / 2, chunk, chunk + CHUNK);
+        benchmark::do_not_optimize(target);
+        return 1;
+    }
+};
+
+template<template<class> class Benchmark, std::size_t Size>
+void run(benchmark::suite& suite, const char* name)
+{
+    static Benchmark<benchmark::payload<Size> > payload;
+    suite.run(name, "payload", Size, SIZE, payload);
+    static Benchmark<Wrapped<Size> > wrapped;
+    suite.run(name, "wrapped", Size, SIZE, wrapped);
+}
+
+int main(int argc, char* argv[])
+{
+    benchmark::suite suite(argc, argv);
+
+    run<AssignOperator, 1>(suite, "operator=");
+    run<AssignOperator, 4>(suite, "operator=");
+    run<AssignOperator, 16>(suite, "operator=");
+
+    run<CopyConstruct, 4>(suite, "declare::vector(const vector&)");
+    run<CopyConstruct, 16>(suite, "declare::vector(const vector&)");
+
+    run<AssignFill, 1>(suite, "assign(n, value)");
+    run<AssignFill, 4>(suite, "assign(n, value)");
+    run<AssignFill, 16>(suite, "assign(n, value)");
+
+    run<InsertFill, 4>(suite, "insert(pos, n, value)");
+    run<InsertFill, 16>(suite, "insert(pos, n, value)");
+
+    run<RangeInsert, 1>(suite, "insert(pos, first, last)");
+    run<RangeInsert, 16>(suite, "insert(pos, first, last)");
+
+    return suite.finish();
+}
@@ -0,0 +1,170 @@
+/**
+ * Compares moving and swapping estd::declare::vector of 64 byte elements
+ * with copying them, for trivially relocatable types, which are moved with
+ * memmove, and for types that have to be moved element by element.
+ * \file
+ * \ingroup estl
+ * \copyright   E.S.R.Labs AG, 2014, All rights reserved.
+ */
+
+#include <estd/vector.h>
+
+#include "benchmark.h"
+
+using namespace esrlabs::estd;
+
+static const std::size_t SIZE = 4096;
+static const std::size_t ELEMENT_SIZE = 64;
+
+/*
+ * Has a user provided copy constructor but opts in to be moved in memory.
+ */
+struct Relocatable
+{
+    Relocatable() : value() {}
+    Relocatable(const Relocatable& other) : value(other.value) {}
+    Relocatable& operator=(const Relocatable& other) { value = other.value; return *this; }
+
+    benchmark::payload<ELEMENT_SIZE> value;
+};
+
+/*
+ * Not trivially copyable and therefore not trivially relocatable, so
+ * estd::vector moves it element by element.
+ */
+struct Pinned
+{
+    Pinned() : value() {}
+    Pinned(const Pinned& other) : value(other.value) {}
+    Pinned& operator=(const Pinned& other) { value = other.value; return *this; }
+
+    benchmark::payload<ELEMENT_SIZE> value;
+};
+
+namespace esrlabs
+{
+namespace estd
+{
+    template<> struct is_trivially_relocatable<Relocatable> : public true_type {};
+} /* namespace estd */
+} /* namespace esrlabs */
+
+template<class T>
+struct CopyConstruct
+{
+    declare::vector<T, SIZE> source;
+
+    CopyConstruct() : source(SIZE, T()) {}
+
+    void setup() {}
+
+    std::size_t run()
+    {
+        declare::vector<T, SIZE> target(source);
+        benchmark::do_not_optimize(target);
+        return 1;
+    }
+};
+
+template<class T>
+struct AssignOperator
+{
+    declare::vector<T, SIZE> source;
+    declare::vector<T, SIZE> target;
+
+    AssignOperator() : source(SIZE, T()), target(SIZE, T()) {}
+
+    void setup() {}
+
+    std::size_t run()
+    {
+        target = source;
+        benchmark::do_not_optimize(target);
+        return 1;
+    }
+};
+
+template<class T>
+struct Swap
+{
+    declare::vector<T, SIZE> a;
+    declare::vector<T, SIZE> b;
+
+    Swap() : a(SIZE, T()), b(SIZE / 2, T()) {}
+
+    void setup() {}
+
+    std::size_t run()
+    {
+        a.swap(b);
+        benchmark::do_not_optimize(a);
+        return 1;
+    }
+};
+
+#if __cplusplus >= 201103L
+template<class T>
+struct MoveConstruct
+{
+    declare::vector<T, SIZE> source;
+
+    void setup()
+    {
+        source.assign(SIZE, T());
+    }
+
+    std::size_t run()
+    {
+        declare::vector<T, SIZE> target(std::move(source));
+        benchmark::do_not_optimize(target);
+        return 1;
+    }
+};
+
+template<class T>
+struct MoveAssign
+{
+    declare::vector<T, SIZE> source;
+    declare::vector<T, SIZE> target;
+
+    MoveAssign() : source(), target(SIZE, T()) {}
+
+    void setup()
+    {
+        source.assign(SIZE, T());
+    }
+
+    std::size_t run()
+    {
+        target = std::move(source);
+        benchmark::do_not_optimize(target);
+        return 1;
+    }
+};
+#endif
+
+template<template<class> class Benchmark>
+void run(benchmark::suite& suite, const char* name)
+{
+    static Benchmark<benchmark::payload<ELEMENT_SIZE> > payload;
+    suite.run(name, "payload", ELEMENT_SIZE, SIZE, payload);
+    static Benchmark<Relocatable> relocatable;
+    suite.run(name, "relocatable", ELEMENT_SIZE, SIZE, relocatable);
+    static Benchmark<Pinned> pinned;
+    suite.run(name, "pinned", ELEMENT_SIZE, SIZE, pinned);
+}
+
+int main(int argc, char* argv[])
+{
+    benchmark::suite suite(argc, argv);
+
+    run<CopyConstruct>(suite, "declare::vector(const vector&)");
+    run<AssignOperator>(suite, "operator=(const vector&)");
+#if __cplusplus >= 201103L
+    run<MoveConstruct>(suite, "declare::vector(vector&&)");
+    run<MoveAssign>(suite, "operator=(vector&&)");
+#endif
+    run<Swap>(suite, "swap(vector&)");
+
+    return suite.finish();
+}
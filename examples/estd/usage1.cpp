@@ -0,0 +1,68 @@
+/**
+ * \file
+ * \ingroup estl
+ * \copyright   E.S.R.Labs AG, 2014, All rights reserved.
+ */
+
+#include <cstdio>
+
+#include <estd/arena.h>
+#include <estd/deque.h>
+#include <estd/usage.h>
+#include <estd/vector.h>
+
+/*
+ * An example of sizing containers with the usage tracking. It has to be
+ * built with ESTL_TRACK_USAGE defined, like every other part of the
+ * program, including src/estd/usage.cpp.
+ */
+#if !defined(ESTL_TRACK_USAGE)
+#error "usage1 has to be built with ESTL_TRACK_USAGE"
+#endif
+
+esrlabs::estd::declare::vector<int, 64> samples;
+esrlabs::estd::declare::deque<int, 16> requests;
+esrlabs::estd::declare::arena<1024> scratch;
+
+/*
+ * Vectors created in an arena are tracked until the arena is rewound.
+ */
+void handleRequest(int request)
+{
+    esrlabs::estd::arena::scope requestScope(scratch);
+    esrlabs::estd::vector<int>* values = scratch.allocate_vector<int>(32);
+    if (values == 0L)
+    {
+        return;
+    }
+    values->usage().set_name("values");
+    for (int i = 0; i < request; ++i)
+    {
+        values->push_back(i);
+    }
+}
+
+int main()
+{
+    samples.usage().set_name("samples");
+    requests.usage().set_name("requests");
+
+    for (int i = 0; i < 20; ++i)
+    {
+        samples.push_back(i);
+        if (!requests.full())
+        {
+            requests.push_back(i);
+        }
+        if (i % 2 == 1)
+        {
+            handleRequest(requests.front());
+            requests.pop_front();
+        }
+    }
+    handleRequest(8);
+
+    // the arena vector has been unregistered when its scope was left
+    esrlabs::estd::dump_usage(stdout);
+    return 0;
+}
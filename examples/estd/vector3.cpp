@@ -38,6 +38,15 @@ private:
     int fValue;
 };
 
+/*
+ * MyClass cannot be copied, so the vector can only shift it in memory when
+ * elements are inserted or erased. This is fine as it does not store its
+ * own address.
+ */
+namespace esrlabs { namespace estd {
+    template<> struct is_trivially_relocatable<MyClass> : public true_type {};
+} }
+
 /*
  * A simple method that initializes the elements in a vector
  */
@@ -0,0 +1,1467 @@
+/**
+ * Contains algorithms for the estd containers which work without heap.
+ * \file
+ * \ingroup estl
+ * \copyright   E.S.R.Labs AG, 2014, All rights reserved.
+ */
+#ifndef ESTD_ALGORITHM_H
+#define ESTD_ALGORITHM_H
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <estd/assert.h>
+#include <estd/config.h>
+#include <estd/estdint.h>
+#include <estd/type_traits.h>
+#include <estd/vector.h>
+
+#if defined(ESTD_HAS_AVX2)
+#include <immintrin.h>
+#elif defined(ESTD_HAS_SSE2)
+#include <emmintrin.h>
+#endif
+
+namespace esrlabs {
+namespace estd {
+
+    namespace internal
+    {
+        /// \cond INTERNAL
+        template<class T>
+        struct identity
+        {
+            const T& operator()(const T& value) const { return value; }
+        };
+
+        /*
+         * Stable merge of the sorted ranges [first, middle) and [middle, last)
+         * by recursive rotations. Unlike std::inplace_merge it never
+         * allocates a buffer.
+         */
+        template<class RandomAccessIterator, class Compare>
+        void merge_without_buffer(
+            RandomAccessIterator first,
+            RandomAccessIterator middle,
+            RandomAccessIterator last,
+            Compare comp)
+        {
+            typedef typename std::iterator_traits<RandomAccessIterator>::difference_type difference_type;
+
+            difference_type const len1 = middle - first;
+            difference_type const len2 = last - middle;
+            if ((len1 == 0) || (len2 == 0))
+            {
+                return;
+            }
+            if ((len1 + len2) == 2)
+            {
+                if (comp(*middle, *first))
+                {
+                    std::iter_swap(first, middle);
+                }
+                return;
+            }
+            RandomAccessIterator firstCut;
+            RandomAccessIterator secondCut;
+            if (len1 > len2)
+            {
+                firstCut = first + len1 / 2;
+                secondCut = std::lower_bound(middle, last, *firstCut, comp);
+            }
+            else
+            {
+                secondCut = middle + len2 / 2;
+                firstCut = std::upper_bound(first, middle, *secondCut, comp);
+            }
+            std::rotate(firstCut, middle, secondCut);
+            RandomAccessIterator const newMiddle = firstCut + (secondCut - middle);
+            merge_without_buffer(first, firstCut, newMiddle, comp);
+            merge_without_buffer(newMiddle, secondCut, last, comp);
+        }
+
+        template<std::size_t Size> struct radix_bits;
+        template<> struct radix_bits<1> { typedef uint8_t type; };
+        template<> struct radix_bits<2> { typedef uint16_t type; };
+        template<> struct radix_bits<4> { typedef uint32_t type; };
+        template<> struct radix_bits<8> { typedef uint64_t type; };
+
+        /*
+         * Sorts a vector with at least one element by the integer keys of
+         * type Key, which is deduced from the key of the first element.
+         */
+        template<class T, class KeyOfValue, class Key>
+        void radix_sort(vector<T>& values, vector<T>& buffer, KeyOfValue key, Key firstKey)
+        {
+            typedef typename radix_bits<sizeof(Key)>::type bits;
+            typedef char keys_have_to_be_integral[is_integral<Key>::value ? 1 : -1];
+            (void)sizeof(keys_have_to_be_integral);
+            std::size_t const PASSES = sizeof(Key);
+            std::size_t const n = values.size();
+            // flipping the sign bit orders signed keys like unsigned ones
+            bits const bias = std::numeric_limits<Key>::is_signed
+                ? static_cast<bits>(static_cast<bits>(1) << (8 * sizeof(Key) - 1))
+                : static_cast<bits>(0);
+
+            buffer.assign(values.begin(), values.end());
+            T* from = &values[0];
+            T* to = &buffer[0];
+            bits const first = static_cast<bits>(static_cast<bits>(firstKey) ^ bias);
+            for (std::size_t pass = 0; pass < PASSES; ++pass)
+            {
+                std::size_t const shift = 8 * pass;
+                // a single histogram, counted again for every pass, keeps
+                // the stack small for wide keys
+                std::size_t offsets[256] = { 0 };
+                for (std::size_t i = 0; i < n; ++i)
+                {
+                    bits const k = static_cast<bits>(static_cast<bits>(key(from[i])) ^ bias);
+                    ++offsets[(k >> shift) & 0xFFU];
+                }
+                // all keys share the byte of this pass
+                if (offsets[(first >> shift) & 0xFFU] == n)
+                {
+                    continue;
+                }
+                std::size_t offset = 0;
+                for (std::size_t byte = 0; byte < 256; ++byte)
+                {
+                    std::size_t const count = offsets[byte];
+                    offsets[byte] = offset;
+                    offset += count;
+                }
+                for (std::size_t i = 0; i < n; ++i)
+                {
+                    bits const k = static_cast<bits>(static_cast<bits>(key(from[i])) ^ bias);
+                    to[offsets[(k >> shift) & 0xFFU]++] = from[i];
+                }
+                std::swap(from, to);
+            }
+            if (from != &values[0])
+            {
+                std::copy(from, from + n, &values[0]);
+            }
+        }
+        /// \endcond
+    } /* namespace internal */
+
+    namespace internal
+    {
+        /// \cond INTERNAL
+#if defined(ESTD_HAS_SSE2)
+        /*
+         * The vector instructions used by the search kernels. A register
+         * holds 32 bytes with AVX2 and 16 bytes with SSE2.
+         */
+#if defined(ESTD_HAS_AVX2)
+        typedef __m256i simd_register;
+
+        inline simd_register simd_load(const void* p)
+        {
+            return _mm256_loadu_si256(static_cast<const simd_register*>(p));
+        }
+
+        inline void simd_store(void* p, simd_register r)
+        {
+            _mm256_storeu_si256(static_cast<simd_register*>(p), r);
+        }
+
+        inline simd_register simd_zero() { return _mm256_setzero_si256(); }
+
+        inline simd_register simd_or(simd_register a, simd_register b) { return _mm256_or_si256(a, b); }
+
+        inline simd_register simd_xor(simd_register a, simd_register b) { return _mm256_xor_si256(a, b); }
+
+        // takes the bytes of a where mask is set and those of b elsewhere
+        inline simd_register simd_select(simd_register mask, simd_register a, simd_register b)
+        {
+            return _mm256_blendv_epi8(b, a, mask);
+        }
+
+        // one bit per byte, set if the highest bit of the byte is set
+        inline uint32_t simd_mask(simd_register r) { return static_cast<uint32_t>(_mm256_movemask_epi8(r)); }
+
+        inline simd_register simd_sub_bytes(simd_register a, simd_register b) { return _mm256_sub_epi8(a, b); }
+
+        // sums up the bytes into one 64 bit integer per 8 bytes
+        inline simd_register simd_sum_bytes(simd_register r) { return _mm256_sad_epu8(r, simd_zero()); }
+
+        inline simd_register simd_add_sums(simd_register a, simd_register b) { return _mm256_add_epi64(a, b); }
+
+        template<std::size_t Size> struct simd_lanes;
+
+        template<> struct simd_lanes<1>
+        {
+            static simd_register broadcast(uint32_t v) { return _mm256_set1_epi8(static_cast<char>(v)); }
+            static simd_register equal(simd_register a, simd_register b) { return _mm256_cmpeq_epi8(a, b); }
+            static simd_register greater(simd_register a, simd_register b) { return _mm256_cmpgt_epi8(a, b); }
+        };
+
+        template<> struct simd_lanes<2>
+        {
+            static simd_register broadcast(uint32_t v) { return _mm256_set1_epi16(static_cast<short>(v)); }
+            static simd_register equal(simd_register a, simd_register b) { return _mm256_cmpeq_epi16(a, b); }
+            static simd_register greater(simd_register a, simd_register b) { return _mm256_cmpgt_epi16(a, b); }
+        };
+
+        template<> struct simd_lanes<4>
+        {
+            static simd_register broadcast(uint32_t v) { return _mm256_set1_epi32(static_cast<int>(v)); }
+            static simd_register equal(simd_register a, simd_register b) { return _mm256_cmpeq_epi32(a, b); }
+            static simd_register greater(simd_register a, simd_register b) { return _mm256_cmpgt_epi32(a, b); }
+        };
+#else
+        typedef __m128i simd_register;
+
+        inline simd_register simd_load(const void* p)
+        {
+            return _mm_loadu_si128(static_cast<const simd_register*>(p));
+        }
+
+        inline void simd_store(void* p, simd_register r)
+        {
+            _mm_storeu_si128(static_cast<simd_register*>(p), r);
+        }
+
+        inline simd_register simd_zero() { return _mm_setzero_si128(); }
+
+        inline simd_register simd_or(simd_register a, simd_register b) { return _mm_or_si128(a, b); }
+
+        inline simd_register simd_xor(simd_register a, simd_register b) { return _mm_xor_si128(a, b); }
+
+        // takes the bytes of a where mask is set and those of b elsewhere
+        inline simd_register simd_select(simd_register mask, simd_register a, simd_register b)
+        {
+            return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+        }
+
+        // one bit per byte, set if the highest bit of the byte is set
+        inline uint32_t simd_mask(simd_register r) { return static_cast<uint32_t>(_mm_movemask_epi8(r)); }
+
+        inline simd_register simd_sub_bytes(simd_register a, simd_register b) { return _mm_sub_epi8(a, b); }
+
+        // sums up the bytes into one 64 bit integer per 8 bytes
+        inline simd_register simd_sum_bytes(simd_register r) { return _mm_sad_epu8(r, simd_zero()); }
+
+        inline simd_register simd_add_sums(simd_register a, simd_register b) { return _mm_add_epi64(a, b); }
+
+        template<std::size_t Size> struct simd_lanes;
+
+        template<> struct simd_lanes<1>
+        {
+            static simd_register broadcast(uint32_t v) { return _mm_set1_epi8(static_cast<char>(v)); }
+            static simd_register equal(simd_register a, simd_register b) { return _mm_cmpeq_epi8(a, b); }
+            static simd_register greater(simd_register a, simd_register b) { return _mm_cmpgt_epi8(a, b); }
+        };
+
+        template<> struct simd_lanes<2>
+        {
+            static simd_register broadcast(uint32_t v) { return _mm_set1_epi16(static_cast<short>(v)); }
+            static simd_register equal(simd_register a, simd_register b) { return _mm_cmpeq_epi16(a, b); }
+            static simd_register greater(simd_register a, simd_register b) { return _mm_cmpgt_epi16(a, b); }
+        };
+
+        template<> struct simd_lanes<4>
+        {
+            static simd_register broadcast(uint32_t v) { return _mm_set1_epi32(static_cast<int>(v)); }
+            static simd_register equal(simd_register a, simd_register b) { return _mm_cmpeq_epi32(a, b); }
+            static simd_register greater(simd_register a, simd_register b) { return _mm_cmpgt_epi32(a, b); }
+        };
+#endif
+
+        /*
+         * True for pointers to integers with 8, 16 or 32 bits, which are
+         * searched by the vector kernels below.
+         */
+        template<class Iterator>
+        struct is_simd_range
+        {
+            typedef typename remove_const<typename remove_pointer<Iterator>::type>::type element;
+
+            static const bool value = is_pointer<Iterator>::value
+                && is_integral<element>::value
+                && !is_same<element, bool>::value
+                && ((sizeof(element) == 1) || (sizeof(element) == 2) || (sizeof(element) == 4));
+        };
+
+        /*
+         * Returns the position of the first element set in an equal mask.
+         */
+        template<class T>
+        inline std::size_t simd_first(uint32_t mask)
+        {
+            return static_cast<std::size_t>(__builtin_ctz(mask)) / sizeof(T);
+        }
+
+        template<class T>
+        const T* simd_find(const T* first, const T* last, T value)
+        {
+            typedef simd_lanes<sizeof(T)> lanes;
+            std::size_t const width = sizeof(simd_register) / sizeof(T);
+
+            if (static_cast<std::size_t>(last - first) < width)
+            {
+                return std::find(first, last, value);
+            }
+            simd_register const needle = lanes::broadcast(static_cast<uint32_t>(value));
+            for (; static_cast<std::size_t>(last - first) > width; first += width)
+            {
+                uint32_t const mask = simd_mask(lanes::equal(simd_load(first), needle));
+                if (mask != 0)
+                {
+                    return first + simd_first<T>(mask);
+                }
+            }
+            // the last register overlaps elements that did not match
+            first = last - width;
+            uint32_t const mask = simd_mask(lanes::equal(simd_load(first), needle));
+            return (mask != 0) ? (first + simd_first<T>(mask)) : last;
+        }
+
+        template<class T>
+        std::size_t simd_count(const T* first, const T* last, T value)
+        {
+            typedef simd_lanes<sizeof(T)> lanes;
+            std::size_t const width = sizeof(simd_register) / sizeof(T);
+
+            simd_register const needle = lanes::broadcast(static_cast<uint32_t>(value));
+            simd_register sums = simd_zero();
+            std::size_t blocks = static_cast<std::size_t>(last - first) / width;
+            while (blocks > 0)
+            {
+                // every byte of a matching element is incremented, a byte
+                // counts up to 255 before the bytes are summed up
+                std::size_t const n = (blocks < 255) ? blocks : 255;
+                simd_register counts = simd_zero();
+                for (std::size_t i = 0; i < n; ++i, first += width)
+                {
+                    counts = simd_sub_bytes(counts, lanes::equal(simd_load(first), needle));
+                }
+                sums = simd_add_sums(sums, simd_sum_bytes(counts));
+                blocks -= n;
+            }
+            uint64_t bytes[sizeof(simd_register) / sizeof(uint64_t)];
+            simd_store(bytes, sums);
+            uint64_t total = 0;
+            for (std::size_t i = 0; i < (sizeof(bytes) / sizeof(bytes[0])); ++i)
+            {
+                total += bytes[i];
+            }
+            return static_cast<std::size_t>(total / sizeof(T))
+                + static_cast<std::size_t>(std::count(first, last, value));
+        }
+
+        /*
+         * Returns the first smallest element or, if Greatest is set, the
+         * first greatest element of a non empty range.
+         */
+        template<class T, bool Greatest>
+        const T* simd_extreme(const T* first, const T* last)
+        {
+            typedef simd_lanes<sizeof(T)> lanes;
+            std::size_t const width = sizeof(simd_register) / sizeof(T);
+
+            if (static_cast<std::size_t>(last - first) < width)
+            {
+                return Greatest ? std::max_element(first, last) : std::min_element(first, last);
+            }
+            // flipping the sign bit orders unsigned lanes by a signed comparison
+            simd_register const bias = std::numeric_limits<T>::is_signed
+                ? simd_zero()
+                : lanes::broadcast(1U << (8 * sizeof(T) - 1));
+            simd_register best = simd_xor(simd_load(first), bias);
+            for (const T* p = first + width; p != last; )
+            {
+                // the last register overlaps elements compared already
+                p = (static_cast<std::size_t>(last - p) < width) ? (last - width) : p;
+                simd_register const v = simd_xor(simd_load(p), bias);
+                best = simd_select(Greatest ? lanes::greater(v, best) : lanes::greater(best, v), v, best);
+                p += width;
+            }
+            T values[width];
+            simd_store(values, simd_xor(best, bias));
+            T const extreme = Greatest
+                ? *std::max_element(values, values + width)
+                : *std::min_element(values, values + width);
+            return simd_find(first, last, extreme);
+        }
+
+        template<class T, class ForwardIterator>
+        const T* simd_find_first_of(
+            const T* first,
+            const T* last,
+            ForwardIterator sFirst,
+            ForwardIterator sLast)
+        {
+            typedef simd_lanes<sizeof(T)> lanes;
+            typedef typename std::iterator_traits<ForwardIterator>::value_type value_type;
+            std::size_t const width = sizeof(simd_register) / sizeof(T);
+            std::size_t const MAX_NEEDLES = 8;
+
+            T values[MAX_NEEDLES];
+            std::size_t n = 0;
+            for (ForwardIterator s = sFirst; s != sLast; ++s)
+            {
+                T const value = static_cast<T>(*s);
+                // skip values that are equal to no element
+                if (static_cast<value_type>(value) != *s)
+                {
+                    continue;
+                }
+                if (n == MAX_NEEDLES)
+                {
+                    return std::find_first_of(first, last, sFirst, sLast);
+                }
+                values[n] = value;
+                ++n;
+            }
+            if ((n == 0) || (static_cast<std::size_t>(last - first) < width))
+            {
+                return std::find_first_of(first, last, values, values + n);
+            }
+            simd_register needles[MAX_NEEDLES];
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                needles[i] = lanes::broadcast(static_cast<uint32_t>(values[i]));
+            }
+            for (const T* p = first; p != last; )
+            {
+                // the last register overlaps elements that did not match
+                p = (static_cast<std::size_t>(last - p) < width) ? (last - width) : p;
+                simd_register const v = simd_load(p);
+                simd_register matches = lanes::equal(v, needles[0]);
+                for (std::size_t i = 1; i < n; ++i)
+                {
+                    matches = simd_or(matches, lanes::equal(v, needles[i]));
+                }
+                uint32_t const mask = simd_mask(matches);
+                if (mask != 0)
+                {
+                    return p + simd_first<T>(mask);
+                }
+                p += width;
+            }
+            return last;
+        }
+#else
+        template<class Iterator>
+        struct is_simd_range
+        {
+            static const bool value = false;
+        };
+#endif
+
+        /*
+         * The algorithms below are selected by a true_type if the range can
+         * be searched by the vector kernels and by a false_type otherwise.
+         */
+        template<class InputIterator, class T>
+        inline InputIterator find(InputIterator first, InputIterator last, const T& value, false_type)
+        {
+            return std::find(first, last, value);
+        }
+
+        template<class InputIterator, class T>
+        inline typename std::iterator_traits<InputIterator>::difference_type
+        count(InputIterator first, InputIterator last, const T& value, false_type)
+        {
+            return std::count(first, last, value);
+        }
+
+        template<class InputIterator, class ForwardIterator>
+        inline InputIterator find_first_of(
+            InputIterator first,
+            InputIterator last,
+            ForwardIterator sFirst,
+            ForwardIterator sLast,
+            false_type)
+        {
+            return std::find_first_of(first, last, sFirst, sLast);
+        }
+
+        template<class ForwardIterator>
+        inline ForwardIterator min_element(ForwardIterator first, ForwardIterator last, false_type)
+        {
+            return std::min_element(first, last);
+        }
+
+        template<class ForwardIterator>
+        inline ForwardIterator max_element(ForwardIterator first, ForwardIterator last, false_type)
+        {
+            return std::max_element(first, last);
+        }
+
+#if defined(ESTD_HAS_SSE2)
+        /*
+         * A value converted to the element type T has to convert back to
+         * itself, otherwise no element compares equal to it.
+         */
+        template<class E, class T>
+        inline E* find(E* first, E* last, const T& value, true_type)
+        {
+            typedef typename remove_const<E>::type element;
+            element const needle = static_cast<element>(value);
+            if (static_cast<T>(needle) != value)
+            {
+                return last;
+            }
+            return first + (simd_find<element>(first, last, needle) - first);
+        }
+
+        template<class E, class T>
+        inline std::ptrdiff_t count(E* first, E* last, const T& value, true_type)
+        {
+            typedef typename remove_const<E>::type element;
+            element const needle = static_cast<element>(value);
+            if (static_cast<T>(needle) != value)
+            {
+                return 0;
+            }
+            return static_cast<std::ptrdiff_t>(simd_count<element>(first, last, needle));
+        }
+
+        template<class E, class ForwardIterator>
+        inline E* find_first_of(
+            E* first,
+            E* last,
+            ForwardIterator sFirst,
+            ForwardIterator sLast,
+            true_type)
+        {
+            typedef typename remove_const<E>::type element;
+            return first + (simd_find_first_of<element>(first, last, sFirst, sLast) - first);
+        }
+
+        template<class E>
+        inline E* min_element(E* first, E* last, true_type)
+        {
+            typedef typename remove_const<E>::type element;
+            return (first == last) ? last : (first + (simd_extreme<element, false>(first, last) - first));
+        }
+
+        template<class E>
+        inline E* max_element(E* first, E* last, true_type)
+        {
+            typedef typename remove_const<E>::type element;
+            return (first == last) ? last : (first + (simd_extreme<element, true>(first, last) - first));
+        }
+#endif
+        /// \endcond
+    } /* namespace internal */
+
+    /**
+     * Returns the first iterator i in the range [first, last) for which
+     * *i == value, or last if there is none.
+     *
+     * Unlike std::find, ranges of 8, 16 or 32 bit integers given by
+     * pointers, like the iterators of an estd::vector<uint8_t>, are compared
+     * with SSE2 or, if the target supports it, AVX2 instructions. The other
+     * algorithms of this file do the same. The instructions are chosen by
+     * the compiler flags, other targets use the algorithms of the STL.
+     *
+     * \complexity Linear in the size of the range.
+     */
+    template<class InputIterator, class T>
+    inline InputIterator find(InputIterator first, InputIterator last, const T& value)
+    {
+        return internal::find(first, last, value,
+            integral_constant<bool, internal::is_simd_range<InputIterator>::value && is_integral<T>::value>());
+    }
+
+    /**
+     * Returns the number of elements in the range [first, last) which are
+     * equal to value.
+     *
+     * \see esrlabs::estd::find
+     * \complexity Linear in the size of the range.
+     */
+    template<class InputIterator, class T>
+    inline typename std::iterator_traits<InputIterator>::difference_type
+    count(InputIterator first, InputIterator last, const T& value)
+    {
+        return internal::count(first, last, value,
+            integral_constant<bool, internal::is_simd_range<InputIterator>::value && is_integral<T>::value>());
+    }
+
+    /**
+     * Returns true if an element of the range [first, last) is equal to
+     * value.
+     *
+     * \see esrlabs::estd::find
+     * \complexity Linear in the size of the range.
+     */
+    template<class InputIterator, class T>
+    inline bool contains(InputIterator first, InputIterator last, const T& value)
+    {
+        return ::esrlabs::estd::find(first, last, value) != last;
+    }
+
+    /**
+     * Returns the first iterator i in the range [first, last) for which *i
+     * is equal to one of the values of the range [sFirst, sLast), or last if
+     * there is none. Up to eight values are compared at once.
+     *
+     * \see esrlabs::estd::find
+     * \complexity Linear in the product of the sizes of both ranges.
+     */
+    template<class InputIterator, class ForwardIterator>
+    inline InputIterator find_first_of(
+        InputIterator first,
+        InputIterator last,
+        ForwardIterator sFirst,
+        ForwardIterator sLast)
+    {
+        typedef typename std::iterator_traits<ForwardIterator>::value_type value_type;
+        return internal::find_first_of(first, last, sFirst, sLast,
+            integral_constant<bool, internal::is_simd_range<InputIterator>::value && is_integral<value_type>::value>());
+    }
+
+    /**
+     * Returns the first smallest element of the range [first, last), or
+     * last if the range is empty.
+     *
+     * \see esrlabs::estd::find
+     * \complexity Linear in the size of the range.
+     */
+    template<class ForwardIterator>
+    inline ForwardIterator min_element(ForwardIterator first, ForwardIterator last)
+    {
+        return internal::min_element(first, last,
+            integral_constant<bool, internal::is_simd_range<ForwardIterator>::value>());
+    }
+
+    /**
+     * Returns the first greatest element of the range [first, last), or
+     * last if the range is empty.
+     *
+     * \see esrlabs::estd::find
+     * \complexity Linear in the size of the range.
+     */
+    template<class ForwardIterator>
+    inline ForwardIterator max_element(ForwardIterator first, ForwardIterator last)
+    {
+        return internal::max_element(first, last,
+            integral_constant<bool, internal::is_simd_range<ForwardIterator>::value>());
+    }
+
+    /**
+     * Sorts the values by a least significant digit radix sort, which takes
+     * one pass over the values per byte of the integer keys. Passes over a
+     * byte that is equal for all keys are skipped. The sort is stable.
+     * Integral keys only, other key types do not compile.
+     *
+     * Instead of allocating memory, the values are moved back and forth
+     * between the vector and a buffer, whose elements are replaced. The
+     * histogram of a pass takes 256 counters on the stack.
+     *
+     * \param values The vector to sort.
+     * \param buffer A vector holding at least values.size() elements.
+     * \param key A function object returning the integral key of a value.
+     * \assert{buffer.max_size() >= values.size()}
+     * \complexity Linear in the size of values.
+     *
+     * \section radix_sort_example Usage example
+     * \code{.cpp}
+     * struct Frame
+     * {
+     *     uint32_t timestamp;
+     *     uint8_t payload[8];
+     * };
+     *
+     * struct FrameTimestamp
+     * {
+     *     uint32_t operator()(const Frame& frame) const { return frame.timestamp; }
+     * };
+     *
+     * esrlabs::estd::declare::vector<Frame, 1024> frames;
+     * esrlabs::estd::declare::vector<Frame, 1024> scratch;
+     *
+     * esrlabs::estd::radix_sort(frames, scratch, FrameTimestamp());
+     * \endcode
+     */
+    template<class T, class KeyOfValue>
+    void radix_sort(vector<T>& values, vector<T>& buffer, KeyOfValue key)
+    {
+        estd_assert(buffer.max_size() >= values.size());
+        estd_assert(&buffer != &values);
+        if (values.size() > 1)
+        {
+            internal::radix_sort(values, buffer, key, key(values[0]));
+        }
+    }
+
+    /**
+     * Sorts a vector of integers by a radix sort.
+     *
+     * \see esrlabs::estd::radix_sort(vector<T>&, vector<T>&, KeyOfValue)
+     */
+    template<class T>
+    inline void radix_sort(vector<T>& values, vector<T>& buffer)
+    {
+        radix_sort(values, buffer, internal::identity<T>());
+    }
+
+    namespace internal
+    {
+        /// \cond INTERNAL
+        /*
+         * The range [start, end) of positions relative to the first element.
+         */
+        struct block_range
+        {
+            block_range() : start(0), end(0) {}
+            block_range(std::size_t s, std::size_t e) : start(s), end(e) {}
+
+            std::size_t length() const { return end - start; }
+
+            std::size_t start;
+            std::size_t end;
+        };
+
+        /*
+         * The pairs of adjacent sorted runs of the given width, which are
+         * merged at one level of a bottom up merge sort.
+         */
+        class level_pairs
+        {
+        public:
+            level_pairs(std::size_t size, std::size_t width)
+            :   _size(size), _width(width), _start(0) {}
+
+            bool next(block_range& a, block_range& b)
+            {
+                if ((_size - _start) <= _width)
+                {
+                    return false;
+                }
+                a = block_range(_start, _start + _width);
+                b = block_range(a.end, ((_size - a.end) > _width) ? (a.end + _width) : _size);
+                _start = b.end;
+                return true;
+            }
+
+        private:
+            std::size_t _size;
+            std::size_t _width;
+            std::size_t _start;
+        };
+
+        /*
+         * The two sorted ranges of an inplace_merge.
+         */
+        class single_pair
+        {
+        public:
+            single_pair(std::size_t middle, std::size_t last)
+            :   _a(0, middle), _b(middle, last), _done(false) {}
+
+            bool next(block_range& a, block_range& b)
+            {
+                a = _a;
+                b = _b;
+                bool const more = !_done;
+                _done = true;
+                return more;
+            }
+
+        private:
+            block_range _a;
+            block_range _b;
+            bool _done;
+        };
+
+        template<class RandomAccessIterator, class Compare>
+        void insertion_sort(RandomAccessIterator first, RandomAccessIterator last, Compare comp)
+        {
+            typedef typename std::iterator_traits<RandomAccessIterator>::value_type value_type;
+
+            for (RandomAccessIterator i = first; i != last; ++i)
+            {
+                value_type value = *i;
+                RandomAccessIterator j = i;
+                for (; (j != first) && comp(value, *(j - 1)); --j)
+                {
+                    *j = *(j - 1);
+                }
+                *j = value;
+            }
+        }
+
+        /*
+         * Merges the sorted ranges [first, middle) and [middle, last) by
+         * moving the smaller one into the buffer. Returns false if it does
+         * not fit.
+         */
+        template<class RandomAccessIterator, class Compare, class T>
+        bool merge_with_buffer(
+            RandomAccessIterator first,
+            RandomAccessIterator middle,
+            RandomAccessIterator last,
+            Compare comp,
+            vector<T>& buffer)
+        {
+            std::size_t const len1 = static_cast<std::size_t>(middle - first);
+            std::size_t const len2 = static_cast<std::size_t>(last - middle);
+            if ((len1 <= len2) && (len1 <= buffer.max_size()))
+            {
+                buffer.assign(first, middle);
+                typename vector<T>::iterator a = buffer.begin();
+                // the output never overtakes the next element of the second range
+                while ((a != buffer.end()) && (middle != last))
+                {
+                    *first++ = comp(*middle, *a) ? *middle++ : *a++;
+                }
+                (void)std::copy(a, buffer.end(), first);
+                return true;
+            }
+            if (len2 <= buffer.max_size())
+            {
+                buffer.assign(middle, last);
+                typename vector<T>::iterator b = buffer.end();
+                while ((b != buffer.begin()) && (middle != first))
+                {
+                    *--last = comp(*(b - 1), *(middle - 1)) ? *--middle : *--b;
+                }
+                (void)std::copy_backward(buffer.begin(), b, last);
+                return true;
+            }
+            return false;
+        }
+
+        /*
+         * Merges pairs of adjacent sorted ranges without a buffer, like the
+         * in-place part of WikiSort. For each level of merges, two internal
+         * buffers of about sqrt(n) unique values are pulled out of the
+         * ranges. The first one tags the blocks of A while they are rolled
+         * through B, the second one is the buffer for merging a block of A
+         * with the elements of B that follow it. Both buffers are sorted
+         * back into the ranges after all pairs have been merged.
+         *
+         * If there are too few unique values for the second buffer, the
+         * blocks are merged by rotations instead, which takes linear time as
+         * well because there are only few unique values.
+         */
+        template<class RandomAccessIterator, class Compare>
+        class block_merge
+        {
+        public:
+            block_merge(RandomAccessIterator first, Compare comp)
+            :   _first(first), _comp(comp) {}
+
+            /*
+             * Merges all pairs, the ranges A of the pairs have at most the
+             * given length.
+             */
+            template<class Pairs>
+            void merge(Pairs pairs, std::size_t length);
+
+        private:
+            // describes where the values of an internal buffer are pulled out
+            struct pull
+            {
+                pull() : from(0), to(0), count(0), range() {}
+
+                pull(std::size_t f, std::size_t t, std::size_t c, block_range r)
+                :   from(f), to(t), count(c), range(r) {}
+
+                std::size_t from;
+                std::size_t to;
+                std::size_t count;
+                block_range range;
+            };
+
+            bool less(std::size_t a, std::size_t b) const
+            {
+                return _comp(_first[a], _first[b]);
+            }
+
+            std::size_t lower(std::size_t value, block_range r) const
+            {
+                return static_cast<std::size_t>(
+                    std::lower_bound(_first + r.start, _first + r.end, _first[value], _comp) - _first);
+            }
+
+            std::size_t upper(std::size_t value, block_range r) const
+            {
+                return static_cast<std::size_t>(
+                    std::upper_bound(_first + r.start, _first + r.end, _first[value], _comp) - _first);
+            }
+
+            void rotate(std::size_t amount, block_range r)
+            {
+                (void)std::rotate(_first + r.start, _first + r.start + amount, _first + r.end);
+            }
+
+            void block_swap(std::size_t a, std::size_t b, std::size_t n)
+            {
+                (void)std::swap_ranges(_first + a, _first + a + n, _first + b);
+            }
+
+            void merge_internal(block_range a, block_range b, block_range buffer);
+
+            void merge_in_place(block_range a, block_range b);
+
+            void merge_step(block_range a, block_range b, block_range buffer)
+            {
+                if (buffer.length() > 0)
+                {
+                    merge_internal(a, b, buffer);
+                }
+                else
+                {
+                    merge_in_place(a, b);
+                }
+            }
+
+            void merge_blocks(
+                block_range a,
+                block_range b,
+                block_range buffer1,
+                block_range buffer2,
+                std::size_t blockSize);
+
+            RandomAccessIterator _first;
+            Compare _comp;
+        };
+
+        template<class RandomAccessIterator, class Compare>
+        template<class Pairs>
+        void block_merge<RandomAccessIterator, Compare>::merge(Pairs pairs, std::size_t length)
+        {
+            std::size_t blockSize = 1;
+            while (((blockSize + 1) * (blockSize + 1)) <= length)
+            {
+                ++blockSize;
+            }
+            std::size_t bufferSize = length / blockSize + 1;
+            std::size_t find = bufferSize + bufferSize;
+            bool findSeparately = false;
+            if (find > length)
+            {
+                // both buffers do not fit into the same range
+                find = bufferSize;
+                findSeparately = true;
+            }
+
+            // find a range with 2 * bufferSize unique values, or two ranges
+            // with bufferSize unique values, or at least the largest buffer
+            block_range buffer1;
+            block_range buffer2;
+            block_range a;
+            block_range b;
+            pull pulls[2];
+            std::size_t pullIndex = 0;
+            Pairs p = pairs;
+            while (p.next(a, b))
+            {
+                // the unique values of A are pulled out to its start
+                std::size_t last = a.start;
+                std::size_t count = 1;
+                for (; count < find; ++count)
+                {
+                    std::size_t const index = upper(last, block_range(last + 1, a.end));
+                    if (index == a.end)
+                    {
+                        break;
+                    }
+                    last = index;
+                }
+                if (count >= bufferSize)
+                {
+                    pulls[pullIndex] = pull(last, a.start, count, block_range(a.start, b.end));
+                    pullIndex = 1;
+                    if (count == (bufferSize + bufferSize))
+                    {
+                        buffer1 = block_range(a.start, a.start + bufferSize);
+                        buffer2 = block_range(a.start + bufferSize, a.start + count);
+                        break;
+                    }
+                    else if ((find == (bufferSize + bufferSize)) || findSeparately)
+                    {
+                        buffer1 = block_range(a.start, a.start + count);
+                        find = bufferSize;
+                        findSeparately = false;
+                    }
+                    else
+                    {
+                        buffer2 = block_range(a.start, a.start + count);
+                        break;
+                    }
+                }
+                else if ((pullIndex == 0) && (count > buffer1.length()))
+                {
+                    buffer1 = block_range(a.start, a.start + count);
+                    pulls[0] = pull(last, a.start, count, block_range(a.start, b.end));
+                }
+
+                // the unique values of B are pulled out to its end
+                last = b.end - 1;
+                count = 1;
+                for (; count < find; ++count)
+                {
+                    std::size_t const index = lower(last, block_range(b.start, last));
+                    if (index == b.start)
+                    {
+                        break;
+                    }
+                    last = index - 1;
+                }
+                if (count >= bufferSize)
+                {
+                    pulls[pullIndex] = pull(last, b.end, count, block_range(a.start, b.end));
+                    pullIndex = 1;
+                    if (count == (bufferSize + bufferSize))
+                    {
+                        buffer1 = block_range(b.end - count, b.end - bufferSize);
+                        buffer2 = block_range(b.end - bufferSize, b.end);
+                        break;
+                    }
+                    else if ((find == (bufferSize + bufferSize)) || findSeparately)
+                    {
+                        buffer1 = block_range(b.end - count, b.end);
+                        find = bufferSize;
+                        findSeparately = false;
+                    }
+                    else
+                    {
+                        // the first buffer may come from A of the same pair
+                        if (pulls[0].range.start == a.start)
+                        {
+                            pulls[0].range.end -= pulls[1].count;
+                        }
+                        buffer2 = block_range(b.end - count, b.end);
+                        break;
+                    }
+                }
+                else if ((pullIndex == 0) && (count > buffer1.length()))
+                {
+                    buffer1 = block_range(b.end - count, b.end);
+                    pulls[0] = pull(last, b.end, count, block_range(a.start, b.end));
+                }
+            }
+
+            // pull out the unique values by rotating them to the buffers
+            for (std::size_t i = 0; i < 2; ++i)
+            {
+                pull& pl = pulls[i];
+                if (pl.to < pl.from)
+                {
+                    std::size_t index = pl.from;
+                    for (std::size_t count = 1; count < pl.count; ++count)
+                    {
+                        index = lower(index - 1, block_range(pl.to, pl.from - (count - 1)));
+                        block_range const range(index + 1, pl.from + 1);
+                        rotate(range.length() - count, range);
+                        pl.from = index + count;
+                    }
+                }
+                else if (pl.to > pl.from)
+                {
+                    std::size_t index = pl.from + 1;
+                    for (std::size_t count = 1; count < pl.count; ++count)
+                    {
+                        index = upper(index, block_range(index, pl.to));
+                        block_range const range(pl.from, index - 1);
+                        rotate(count, range);
+                        pl.from = index - 1 - count;
+                    }
+                }
+            }
+
+            // the first buffer needs a tag for each block of A
+            bufferSize = buffer1.length();
+            blockSize = length / bufferSize + 1;
+
+            p = pairs;
+            while (p.next(a, b))
+            {
+                // leave out the internal buffers
+                std::size_t const start = a.start;
+                for (std::size_t i = 0; i < 2; ++i)
+                {
+                    if (start == pulls[i].range.start)
+                    {
+                        if (pulls[i].from > pulls[i].to)
+                        {
+                            a.start += pulls[i].count;
+                        }
+                        else if (pulls[i].from < pulls[i].to)
+                        {
+                            b.end -= pulls[i].count;
+                        }
+                    }
+                }
+                if ((a.length() == 0) || (b.length() == 0))
+                {
+                    continue;
+                }
+                if (less(b.end - 1, a.start))
+                {
+                    // the ranges are in reverse order
+                    rotate(a.length(), block_range(a.start, b.end));
+                }
+                else if (less(a.end, a.end - 1))
+                {
+                    merge_blocks(a, b, buffer1, buffer2, blockSize);
+                }
+            }
+
+            // the second buffer has been mixed up, the first one is sorted
+            insertion_sort(_first + buffer2.start, _first + buffer2.end, _comp);
+
+            // redistribute the buffers by the opposite of pulling them out
+            for (std::size_t i = 0; i < 2; ++i)
+            {
+                pull const& pl = pulls[i];
+                if (pl.from > pl.to)
+                {
+                    block_range buffer(pl.range.start, pl.range.start + pl.count);
+                    while (buffer.length() > 0)
+                    {
+                        std::size_t const index = lower(buffer.start, block_range(buffer.end, pl.range.end));
+                        std::size_t const amount = index - buffer.end;
+                        rotate(buffer.length(), block_range(buffer.start, index));
+                        buffer.start += amount + 1;
+                        buffer.end += amount;
+                    }
+                }
+                else if (pl.from < pl.to)
+                {
+                    block_range buffer(pl.range.end - pl.count, pl.range.end);
+                    while (buffer.length() > 0)
+                    {
+                        std::size_t const index = upper(buffer.end - 1, block_range(pl.range.start, buffer.start));
+                        std::size_t const amount = buffer.start - index;
+                        rotate(amount, block_range(index, buffer.end));
+                        buffer.start -= amount;
+                        buffer.end -= amount + 1;
+                    }
+                }
+            }
+        }
+
+        template<class RandomAccessIterator, class Compare>
+        void block_merge<RandomAccessIterator, Compare>::merge_blocks(
+            block_range a,
+            block_range b,
+            block_range buffer1,
+            block_range buffer2,
+            std::size_t blockSize)
+        {
+            // A is split into an unevenly sized first block and full blocks
+            block_range blockA = a;
+            block_range const firstA(a.start, a.start + blockA.length() % blockSize);
+
+            // tag each full block of A by swapping its first value with the first buffer
+            std::size_t indexA = buffer1.start;
+            for (std::size_t index = firstA.end; index < blockA.end; index += blockSize)
+            {
+                std::swap(_first[indexA], _first[index]);
+                ++indexA;
+            }
+
+            // roll the blocks of A through B, dropping the smallest one
+            // behind whenever the next block of B has to go after it
+            block_range lastA = firstA;
+            block_range lastB;
+            block_range blockB(b.start, b.start + ((b.length() < blockSize) ? b.length() : blockSize));
+            blockA.start += firstA.length();
+            indexA = buffer1.start;
+
+            if (buffer2.length() > 0)
+            {
+                block_swap(lastA.start, buffer2.start, lastA.length());
+            }
+
+            while (blockA.length() > 0)
+            {
+                if (((lastB.length() > 0) && !less(lastB.end - 1, indexA)) || (blockB.length() == 0))
+                {
+                    // split the previous block of B at the original first value of the block to drop
+                    std::size_t const bSplit = lower(indexA, lastB);
+                    std::size_t const bRemaining = lastB.end - bSplit;
+
+                    // the block with the smallest tag is the smallest block
+                    std::size_t minA = blockA.start;
+                    for (std::size_t findA = minA + blockSize; findA < blockA.end; findA += blockSize)
+                    {
+                        if (less(findA, minA))
+                        {
+                            minA = findA;
+                        }
+                    }
+                    block_swap(blockA.start, minA, blockSize);
+
+                    // restore the first value of the dropped block
+                    std::swap(_first[blockA.start], _first[indexA]);
+                    ++indexA;
+
+                    // merge the previous block of A with the values of B following it
+                    merge_step(lastA, block_range(lastA.end, bSplit), buffer2);
+
+                    if (buffer2.length() > 0)
+                    {
+                        // the dropped block goes into the second buffer, whose
+                        // values are free to be swapped behind the rest of B
+                        block_swap(blockA.start, buffer2.start, blockSize);
+                        block_swap(bSplit, blockA.start + blockSize - bRemaining, bRemaining);
+                    }
+                    else
+                    {
+                        rotate(blockA.start - bSplit, block_range(bSplit, blockA.start + blockSize));
+                    }
+
+                    lastA = block_range(blockA.start - bRemaining, blockA.start - bRemaining + blockSize);
+                    lastB = block_range(lastA.end, lastA.end + bRemaining);
+                    blockA.start += blockSize;
+                }
+                else if (blockB.length() < blockSize)
+                {
+                    // move the last, unevenly sized block of B before the blocks of A
+                    rotate(blockB.start - blockA.start, block_range(blockA.start, blockB.end));
+                    lastB = block_range(blockA.start, blockA.start + blockB.length());
+                    blockA.start += blockB.length();
+                    blockA.end += blockB.length();
+                    blockB.end = blockB.start;
+                }
+                else
+                {
+                    // roll the leftmost block of A to the end by swapping it with the next block of B
+                    block_swap(blockA.start, blockB.start, blockSize);
+                    lastB = block_range(blockA.start, blockA.start + blockSize);
+                    blockA.start += blockSize;
+                    blockA.end += blockSize;
+                    blockB.start += blockSize;
+                    blockB.end = ((b.end - blockB.end) > blockSize) ? (blockB.end + blockSize) : b.end;
+                }
+            }
+
+            merge_step(lastA, block_range(lastA.end, b.end), buffer2);
+        }
+
+        /*
+         * Merges A, whose values have been swapped into the buffer, with B.
+         */
+        template<class RandomAccessIterator, class Compare>
+        void block_merge<RandomAccessIterator, Compare>::merge_internal(
+            block_range a,
+            block_range b,
+            block_range buffer)
+        {
+            std::size_t countA = 0;
+            std::size_t countB = 0;
+            std::size_t insert = 0;
+            if ((a.length() > 0) && (b.length() > 0))
+            {
+                while (true)
+                {
+                    if (!less(b.start + countB, buffer.start + countA))
+                    {
+                        std::swap(_first[a.start + insert], _first[buffer.start + countA]);
+                        ++countA;
+                        ++insert;
+                        if (countA >= a.length())
+                        {
+                            break;
+                        }
+                    }
+                    else
+                    {
+                        std::swap(_first[a.start + insert], _first[b.start + countB]);
+                        ++countB;
+                        ++insert;
+                        if (countB >= b.length())
+                        {
+                            break;
+                        }
+                    }
+                }
+            }
+            block_swap(buffer.start + countA, a.start + insert, a.length() - countA);
+        }
+
+        /*
+         * Merges A and B by rotating the values of A into B.
+         */
+        template<class RandomAccessIterator, class Compare>
+        void block_merge<RandomAccessIterator, Compare>::merge_in_place(block_range a, block_range b)
+        {
+            while ((a.length() > 0) && (b.length() > 0))
+            {
+                std::size_t const middle = lower(a.start, b);
+                std::size_t const amount = middle - a.end;
+                rotate(a.length(), block_range(a.start, middle));
+                if (middle == b.end)
+                {
+                    break;
+                }
+                b.start = middle;
+                a = block_range(a.start + amount, b.start);
+                a.start = upper(a.start, a);
+            }
+        }
+
+        template<class RandomAccessIterator, class Compare, class T>
+        void stable_sort(
+            RandomAccessIterator first,
+            RandomAccessIterator last,
+            Compare comp,
+            vector<T>* buffer)
+        {
+            std::size_t const RUN = 32;
+            std::size_t const size = static_cast<std::size_t>(last - first);
+            for (std::size_t start = 0; start < size; start += RUN)
+            {
+                insertion_sort(first + start, first + (((size - start) > RUN) ? (start + RUN) : size), comp);
+            }
+            for (std::size_t width = RUN; width < size; width += width)
+            {
+                if ((buffer != 0L) && (buffer->max_size() >= width))
+                {
+                    level_pairs pairs(size, width);
+                    block_range a;
+                    block_range b;
+                    while (pairs.next(a, b))
+                    {
+                        if (comp(first[b.start], first[a.end - 1]))
+                        {
+                            (void)merge_with_buffer(first + a.start, first + b.start, first + b.end, comp, *buffer);
+                        }
+                    }
+                }
+                else
+                {
+                    block_merge<RandomAccessIterator, Compare>(first, comp).merge(level_pairs(size, width), width);
+                }
+            }
+        }
+
+        template<class RandomAccessIterator, class Compare, class T>
+        void inplace_merge(
+            RandomAccessIterator first,
+            RandomAccessIterator middle,
+            RandomAccessIterator last,
+            Compare comp,
+            vector<T>* buffer)
+        {
+            std::size_t const RUN = 32;
+            if ((first == middle) || (middle == last) || !comp(*middle, *(middle - 1)))
+            {
+                return;
+            }
+            if ((buffer != 0L) && merge_with_buffer(first, middle, last, comp, *buffer))
+            {
+                return;
+            }
+            std::size_t const len1 = static_cast<std::size_t>(middle - first);
+            std::size_t const len2 = static_cast<std::size_t>(last - middle);
+            if ((len1 + len2) <= RUN)
+            {
+                merge_without_buffer(first, middle, last, comp);
+                return;
+            }
+            block_merge<RandomAccessIterator, Compare>(first, comp).merge(single_pair(len1, len1 + len2), len1);
+        }
+        /// \endcond
+    } /* namespace internal */
+
+    /**
+     * Sorts the elements of the range [first, last) such that equivalent
+     * elements keep their order, without allocating memory.
+     *
+     * Unlike std::stable_sort, which takes O(n log^2 n) steps if it fails
+     * to allocate a buffer, this is a block merge sort in the manner of
+     * WikiSort: runs are merged bottom up using a few unique values of the
+     * range as internal buffers, which takes O(n log n) comparisons and
+     * assignments and constant additional memory.
+     *
+     * \complexity O(n log n)
+     */
+    template<class RandomAccessIterator, class Compare>
+    void stable_sort(RandomAccessIterator first, RandomAccessIterator last, Compare comp)
+    {
+        internal::stable_sort(first, last, comp,
+            static_cast<vector<typename std::iterator_traits<RandomAccessIterator>::value_type>*>(0L));
+    }
+
+    /**
+     * Sorts the elements of the range [first, last) stably using operator<.
+     *
+     * \see esrlabs::estd::stable_sort(RandomAccessIterator, RandomAccessIterator, Compare)
+     */
+    template<class RandomAccessIterator>
+    void stable_sort(RandomAccessIterator first, RandomAccessIterator last)
+    {
+        ::esrlabs::estd::stable_sort(first, last,
+            std::less<typename std::iterator_traits<RandomAccessIterator>::value_type>());
+    }
+
+    /**
+     * Sorts the elements of the range [first, last) stably. Runs that fit
+     * into the buffer are merged by moving them into it, which is faster
+     * than the merge without buffer used for longer runs. Half of the size
+     * of the range is enough to use the buffer for all merges. The
+     * elements of the buffer are replaced.
+     *
+     * \see esrlabs::estd::stable_sort(RandomAccessIterator, RandomAccessIterator, Compare)
+     */
+    template<class RandomAccessIterator, class T, class Compare>
+    void stable_sort(RandomAccessIterator first, RandomAccessIterator last, vector<T>& buffer, Compare comp)
+    {
+        internal::stable_sort(first, last, comp, &buffer);
+    }
+
+    /**
+     * Merges the consecutive sorted ranges [first, middle) and
+     * [middle, last) into one sorted range, without allocating memory.
+     * Equivalent elements keep their order, elements of the first range go
+     * before those of the second one.
+     *
+     * \see esrlabs::estd::stable_sort(RandomAccessIterator, RandomAccessIterator, Compare)
+     * \complexity Linear in the size of the range.
+     */
+    template<class RandomAccessIterator, class Compare>
+    void inplace_merge(
+        RandomAccessIterator first,
+        RandomAccessIterator middle,
+        RandomAccessIterator last,
+        Compare comp)
+    {
+        internal::inplace_merge(first, middle, last, comp,
+            static_cast<vector<typename std::iterator_traits<RandomAccessIterator>::value_type>*>(0L));
+    }
+
+    /**
+     * Merges two consecutive sorted ranges using operator<.
+     *
+     * \see esrlabs::estd::inplace_merge(RandomAccessIterator, RandomAccessIterator, RandomAccessIterator, Compare)
+     */
+    template<class RandomAccessIterator>
+    void inplace_merge(RandomAccessIterator first, RandomAccessIterator middle, RandomAccessIterator last)
+    {
+        ::esrlabs::estd::inplace_merge(first, middle, last,
+            std::less<typename std::iterator_traits<RandomAccessIterator>::value_type>());
+    }
+
+    /**
+     * Merges two consecutive sorted ranges, moving the shorter one into the
+     * buffer if it fits. The elements of the buffer are replaced.
+     *
+     * \see esrlabs::estd::inplace_merge(RandomAccessIterator, RandomAccessIterator, RandomAccessIterator, Compare)
+     */
+    template<class RandomAccessIterator, class T, class Compare>
+    void inplace_merge(
+        RandomAccessIterator first,
+        RandomAccessIterator middle,
+        RandomAccessIterator last,
+        vector<T>& buffer,
+        Compare comp)
+    {
+        internal::inplace_merge(first, middle, last, comp, &buffer);
+    }
+
+} /* namespace estd */
+} /* namespace esrlabs */
+
+#endif /* ESTD_ALGORITHM_H */
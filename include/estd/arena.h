@@ -0,0 +1,392 @@
+/**
+ * Contains esrlabs::estd::arena and esrlabs::estd::declare::arena.
+ * \file
+ * \ingroup estl
+ * \copyright   E.S.R.Labs AG, 2014, All rights reserved.
+ */
+#ifndef ESTD_ARENA_H
+#define ESTD_ARENA_H
+
+#include <new>
+#include <estd/assert.h>
+#include <estd/type_traits.h>
+#include <estd/uncopyable.h>
+#include <estd/vector.h>
+
+namespace esrlabs {
+namespace estd {
+
+    namespace internal
+    {
+        /// \cond INTERNAL
+        /*
+         * Gives the arena access to the protected constructor of vector.
+         */
+        template<class T>
+        class arena_vector
+        :   public vector<T>
+        {
+        public:
+            arena_vector(uint8_t data[], std::size_t size) : vector<T>(data, size) {}
+
+            ~arena_vector() { vector<T>::clear(); }
+
+            static void destroy(void* object)
+            {
+                static_cast<arena_vector*>(object)->~arena_vector();
+            }
+        };
+        /// \endcond
+    } /* namespace internal */
+
+    /**
+     * A monotonic arena handing out aligned buffers from a fixed-sized
+     * storage by advancing a position, e.g. for vectors whose capacity is
+     * only known at runtime.
+     *
+     * Memory is not released individually but by rewinding the arena to a
+     * marker taken earlier, which also destroys all vectors created since.
+     * A scope rewinds the arena when it goes out of scope.
+     *
+     * \section arena_example Usage example
+     * \code{.cpp}
+     * esrlabs::estd::declare::arena<4096> scratch;
+     *
+     * void handleRequest(const Config& config)
+     * {
+     *     esrlabs::estd::arena::scope requestScope(scratch);
+     *     esrlabs::estd::vector<Sample>* samples =
+     *         scratch.allocate_vector<Sample>(config.sampleCount);
+     *     if (samples == 0L)
+     *     {
+     *         return;
+     *     }
+     *     ...
+     * } // samples is destroyed and its memory reused by the next request
+     * \endcode
+     *
+     * \see esrlabs::estd::declare::arena
+     */
+    class arena
+    {
+        UNCOPYABLE(arena);
+
+        struct destructor;
+
+    public:
+        /** An unsigned integral type for the size */
+        typedef std::size_t size_type;
+
+        /**
+         * A position of the arena to rewind to.
+         */
+        class marker
+        {
+        public:
+            marker() : _position(0), _destructors(0L) {}
+
+        private:
+            friend class arena;
+
+            marker(size_type position, destructor* destructors)
+            :   _position(position), _destructors(destructors) {}
+
+            size_type _position;
+            destructor* _destructors;
+        };
+
+        /**
+         * Rewinds an arena to the position it had when the scope has been
+         * constructed.
+         */
+        class scope
+        {
+            UNCOPYABLE(scope);
+
+        public:
+            /**
+             * Remembers the current position of a.
+             */
+            explicit scope(arena& a) : _arena(a), _marker(a.mark()) {}
+
+            /**
+             * Rewinds the arena.
+             */
+            ~scope() { _arena.rewind(_marker); }
+
+        private:
+            arena& _arena;
+            marker const _marker;
+        };
+
+        /**
+         * A simple destructor. This destructor does not destroy the vectors
+         * created by this arena. The derived class arena will do that.
+         */
+        ~arena();
+
+        /**
+         * Returns the number of bytes in use, including alignment padding.
+         *
+         * \complexity Constant
+         */
+        size_type size() const;
+
+        /**
+         * Returns the number of bytes of the storage.
+         *
+         * \complexity Constant
+         */
+        size_type max_size() const;
+
+        /**
+         * Returns the highest number of bytes that have been in use.
+         *
+         * \complexity Constant
+         */
+        size_type high_water_mark() const;
+
+        /**
+         * Returns a buffer of the given size and alignment.
+         *
+         * \param size The size of the buffer in bytes.
+         * \param alignment The alignment, a power of two.
+         * \return The buffer or 0L if the arena is exhausted.
+         * \complexity Constant
+         */
+        uint8_t* allocate(size_type size, size_type alignment);
+
+        /**
+         * Creates an empty vector with storage for n elements of type T.
+         * The vector is destroyed when the arena is rewound.
+         *
+         * \return The vector or 0L if the arena is exhausted.
+         * \complexity Constant
+         */
+        template<class T>
+        vector<T>* allocate_vector(size_type n);
+
+        /**
+         * Returns a marker for the current position.
+         */
+        marker mark() const;
+
+        /**
+         * Destroys all vectors created after the marker has been taken, in
+         * reverse order of creation, and makes their memory available again.
+         *
+         * \assert{The marker has not been rewound over already.}
+         */
+        void rewind(const marker& m);
+
+        /**
+         * Destroys all vectors and makes the whole storage available again.
+         */
+        void reset();
+
+    protected:
+        /**
+         * Constructor to initialize this arena with the actual data to work with.
+         * Used by the declare class.
+         *
+         * \param data The actual data for this arena
+         * \param size The size of the data array
+         */
+        arena(uint8_t data[], size_type size);
+
+    private:
+        // entry of the list of objects to destroy on rewind
+        struct destructor
+        {
+            void (*destroy)(void* object);
+            void* object;
+            destructor* next;
+        };
+
+        uint8_t* _data;
+        size_type _max_size;
+        size_type _position;
+        size_type _high_water_mark;
+        destructor* _destructors;
+    };
+
+    /*
+     * namespace to declare an arena
+     */
+    namespace declare
+    {
+
+        /**
+         * Arena with static size.
+         *
+         * \tparam  Bytes   Size of the storage in bytes.
+         */
+        template<std::size_t Bytes>
+        class arena
+        :   public ::esrlabs::estd::arena
+        {
+        public:
+            typedef ::esrlabs::estd::arena base;
+
+            /**
+             * Constructs an empty arena.
+             */
+            arena();
+
+            /**
+             * Destroys all vectors created by this arena.
+             */
+            ~arena();
+
+        private:
+            typename aligned_storage<Bytes>::type _data;
+        };
+
+    } /* namespace declare */
+
+/*
+ *
+ * Implementation of arena
+ *
+ */
+
+inline
+arena::arena(uint8_t data[], size_type size)
+:   _data(data)
+,   _max_size(size)
+,   _position(0)
+,   _high_water_mark(0)
+,   _destructors(0L)
+{}
+
+inline
+arena::~arena()
+{
+
+}
+
+inline
+arena::size_type
+arena::size() const
+{
+    return _position;
+}
+
+inline
+arena::size_type
+arena::max_size() const
+{
+    return _max_size;
+}
+
+inline
+arena::size_type
+arena::high_water_mark() const
+{
+    return _high_water_mark;
+}
+
+inline
+uint8_t*
+arena::allocate(size_type size, size_type alignment)
+{
+    estd_assert((alignment > 0) && ((alignment & (alignment - 1)) == 0));
+    size_type const address = reinterpret_cast<size_type>(_data + _position);
+    size_type const padding = (alignment - (address & (alignment - 1))) & (alignment - 1);
+    if ((padding > (_max_size - _position)) || (size > (_max_size - _position - padding)))
+    {
+        return 0L;
+    }
+    uint8_t* const buffer = _data + _position + padding;
+    _position += padding + size;
+    if (_position > _high_water_mark)
+    {
+        _high_water_mark = _position;
+    }
+    return buffer;
+}
+
+template<class T>
+vector<T>*
+arena::allocate_vector(size_type n)
+{
+    typedef internal::arena_vector<T> arena_vector;
+
+    marker const start = mark();
+    // trivially copyable elements have nothing to destroy, unless the
+    // vector has to unregister its usage
+#if defined(ESTL_TRACK_USAGE)
+    bool const needsDestructor = true;
+#else
+    bool const needsDestructor = !is_trivially_copyable<T>::value;
+#endif
+    destructor* const entry = needsDestructor
+        ? reinterpret_cast<destructor*>(allocate(sizeof(destructor), alignment_of<destructor>::value))
+        : 0L;
+    uint8_t* const object = allocate(sizeof(arena_vector), alignment_of<arena_vector>::value);
+    uint8_t* const data = allocate(sizeof(T) * n, alignment_of<T>::value);
+    if ((object == 0L) || (data == 0L) || (needsDestructor && (entry == 0L)))
+    {
+        rewind(start);
+        return 0L;
+    }
+    arena_vector* const v = new(object)arena_vector(data, sizeof(T) * n);
+    if (needsDestructor)
+    {
+        entry->destroy = &arena_vector::destroy;
+        entry->object = v;
+        entry->next = _destructors;
+        _destructors = entry;
+    }
+    return v;
+}
+
+inline
+arena::marker
+arena::mark() const
+{
+    return marker(_position, _destructors);
+}
+
+inline
+void
+arena::rewind(const marker& m)
+{
+    estd_assert(m._position <= _position);
+    while (_destructors != m._destructors)
+    {
+        destructor* const entry = _destructors;
+        _destructors = entry->next;
+        entry->destroy(entry->object);
+    }
+    _position = m._position;
+}
+
+inline
+void
+arena::reset()
+{
+    rewind(marker());
+}
+
+namespace declare
+{
+
+    template<std::size_t Bytes>
+    arena<Bytes>::arena()
+    :   ::esrlabs::estd::arena(_data.data, Bytes)
+    {}
+
+    template<std::size_t Bytes>
+    arena<Bytes>::~arena()
+    {
+        base::reset();
+    }
+
+} /* namespace declare */
+
+} /* namespace estd */
+
+} /* namespace esrlabs */
+
+#endif
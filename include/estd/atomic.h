@@ -0,0 +1,181 @@
+/**
+ * Contains esrlabs::estd::atomic.
+ * \file
+ * \ingroup estl
+ * \copyright   E.S.R.Labs AG, 2014, All rights reserved.
+ */
+#ifndef ESTD_ATOMIC_H
+#define ESTD_ATOMIC_H
+
+#include <estd/estdint.h>
+#include <estd/uncopyable.h>
+
+#ifndef ESTD_HAS_ATOMIC_BUILTINS
+#  error "estd/atomic.h is not supported by this compiler configuration"
+#endif
+
+namespace esrlabs {
+namespace estd {
+
+    /**
+     * Memory ordering constraints of atomic operations. They have the same
+     * meaning as the C++11 std::memory_order values.
+     */
+    enum memory_order
+    {
+        memory_order_relaxed = __ATOMIC_RELAXED,
+        memory_order_acquire = __ATOMIC_ACQUIRE,
+        memory_order_release = __ATOMIC_RELEASE,
+        memory_order_acq_rel = __ATOMIC_ACQ_REL,
+        memory_order_seq_cst = __ATOMIC_SEQ_CST
+    };
+
+    /**
+     * A minimal C++98 compatible subset of the C++11 std::atomic for
+     * integral types, implemented on the compiler's atomic builtins.
+     *
+     * \tparam  T   An integral type that fits into a machine word.
+     */
+    template<class T>
+    class atomic
+    {
+        UNCOPYABLE(atomic);
+
+    public:
+        /**
+         * Initializes this atomic with the given value. The initialization
+         * itself is not atomic.
+         */
+        explicit atomic(T value = T());
+
+        /**
+         * Atomically returns the current value.
+         */
+        T load(memory_order order = memory_order_seq_cst) const;
+
+        /**
+         * Atomically replaces the current value.
+         */
+        void store(T value, memory_order order = memory_order_seq_cst);
+
+        /**
+         * Atomically replaces the current value and returns the previous one.
+         */
+        T exchange(T value, memory_order order = memory_order_seq_cst);
+
+        /**
+         * Replaces the current value with desired if it equals expected.
+         * Otherwise expected is updated with the current value. May fail
+         * spuriously.
+         *
+         * \return true if the value has been replaced.
+         */
+        bool compare_exchange_weak(
+            T& expected,
+            T desired,
+            memory_order order = memory_order_seq_cst);
+
+        /**
+         * Replaces the current value with desired if it equals expected.
+         * Otherwise expected is updated with the current value.
+         *
+         * \return true if the value has been replaced.
+         */
+        bool compare_exchange_strong(
+            T& expected,
+            T desired,
+            memory_order order = memory_order_seq_cst);
+
+        /**
+         * Atomically adds value and returns the previous value.
+         */
+        T fetch_add(T value, memory_order order = memory_order_seq_cst);
+
+        /**
+         * Atomically subtracts value and returns the previous value.
+         */
+        T fetch_sub(T value, memory_order order = memory_order_seq_cst);
+
+    private:
+        static int failure_order(memory_order order);
+
+        T _value;
+    };
+
+/*
+ *
+ * Implementation
+ *
+ */
+
+template<class T>inline
+atomic<T>::atomic(T value)
+:   _value(value)
+{}
+
+template<class T>inline
+T
+atomic<T>::load(memory_order order) const
+{
+    return __atomic_load_n(&_value, order);
+}
+
+template<class T>inline
+void
+atomic<T>::store(T value, memory_order order)
+{
+    __atomic_store_n(&_value, value, order);
+}
+
+template<class T>inline
+T
+atomic<T>::exchange(T value, memory_order order)
+{
+    return __atomic_exchange_n(&_value, value, order);
+}
+
+template<class T>inline
+int
+atomic<T>::failure_order(memory_order order)
+{
+    // the failure order must not contain a release
+    switch (order)
+    {
+    case memory_order_release: return __ATOMIC_RELAXED;
+    case memory_order_acq_rel: return __ATOMIC_ACQUIRE;
+    default:                   return order;
+    }
+}
+
+template<class T>inline
+bool
+atomic<T>::compare_exchange_weak(T& expected, T desired, memory_order order)
+{
+    return __atomic_compare_exchange_n(&_value, &expected, desired, true, order, failure_order(order));
+}
+
+template<class T>inline
+bool
+atomic<T>::compare_exchange_strong(T& expected, T desired, memory_order order)
+{
+    return __atomic_compare_exchange_n(&_value, &expected, desired, false, order, failure_order(order));
+}
+
+template<class T>inline
+T
+atomic<T>::fetch_add(T value, memory_order order)
+{
+    return __atomic_fetch_add(&_value, value, order);
+}
+
+template<class T>inline
+T
+atomic<T>::fetch_sub(T value, memory_order order)
+{
+    return __atomic_fetch_sub(&_value, value, order);
+}
+
+} /* namespace estd */
+} /* namespace esrlabs */
+
+#endif /* ESTD_ATOMIC_H */
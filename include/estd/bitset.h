@@ -0,0 +1,824 @@
+/**
+ * Contains esrlabs::estd::bitset_view and esrlabs::estd::declare::bitset.
+ * \file
+ * \ingroup estl
+ * \copyright   E.S.R.Labs AG, 2014, All rights reserved.
+ */
+#ifndef ESTD_BITSET_H
+#define ESTD_BITSET_H
+
+#include <climits>
+#include <cstddef>
+#include <estd/assert.h>
+#include <estd/config.h>
+
+namespace esrlabs {
+namespace estd {
+
+    namespace internal
+    {
+        /// \cond INTERNAL
+        /*
+         * Returns the number of set bits of word.
+         */
+        inline std::size_t popcount(unsigned long word)
+        {
+#ifdef ESTD_HAS_BIT_BUILTINS
+            return static_cast<std::size_t>(__builtin_popcountl(word));
+#else
+            // counts the bits of 2, 4 and 8 bit fields in parallel, the masks
+            // 0x55.., 0x33.., 0x0f.. and 0x01.. fit any width of a long
+            unsigned long const ones = ~0UL;
+            word = word - ((word >> 1) & (ones / 3));
+            word = (word & (ones / 15 * 3)) + ((word >> 2) & (ones / 15 * 3));
+            word = (word + (word >> 4)) & (ones / 255 * 15);
+            return static_cast<std::size_t>(
+                (word * (ones / 255)) >> ((sizeof(unsigned long) - 1) * CHAR_BIT));
+#endif
+        }
+
+        /*
+         * Returns the index of the lowest set bit of word, which must not
+         * be zero.
+         */
+        inline std::size_t count_trailing_zeros(unsigned long word)
+        {
+#ifdef ESTD_HAS_BIT_BUILTINS
+            return static_cast<std::size_t>(__builtin_ctzl(word));
+#else
+            // the bits below the lowest set bit
+            return popcount((word & (0UL - word)) - 1UL);
+#endif
+        }
+        /// \endcond
+    } /* namespace internal */
+
+    /**
+     * A fixed-sized set of bits stored in an array of words owned by
+     * someone else.
+     *
+     * All operations work on whole words: and, or, xor and counting take
+     * one instruction per word, and searching a set or an unset bit skips
+     * a word at a time and scans the first interesting word with a single
+     * bit scan instruction. Compared to a vector of bool or of bytes, a
+     * bitset uses an eighth of the memory.
+     *
+     * The bits of the last word beyond size() are always zero.
+     *
+     * \section bitset_example Usage example
+     * \code{.cpp}
+     * esrlabs::estd::declare::bitset<64> used;
+     *
+     * std::size_t allocate()
+     * {
+     *     std::size_t const slot = used.find_first_unset();
+     *     if (slot != esrlabs::estd::bitset_view::npos)
+     *     {
+     *         used.set(slot);
+     *     }
+     *     return slot;
+     * }
+     *
+     * for (std::size_t i = used.find_first(); i != used.npos; i = used.find_next(i))
+     * {
+     *     poll(i);
+     * }
+     * \endcode
+     *
+     * \see esrlabs::estd::declare::bitset
+     */
+    class bitset_view
+    {
+    public:
+        /** The type of the words holding the bits */
+        typedef unsigned long word_type;
+        /** An unsigned integral type for the size */
+        typedef std::size_t   size_type;
+
+        /** The number of bits of a word */
+        static const size_type BITS_PER_WORD = sizeof(word_type) * CHAR_BIT;
+
+        /** The position returned by the find methods if nothing has been found */
+        static const size_type npos = static_cast<size_type>(-1);
+
+        /**
+         * Returns the number of words needed for the given number of bits.
+         */
+        static size_type words_for(size_type bits);
+
+        /**
+         * Constructs a view of size bits on the given words.
+         *
+         * \param words The storage of the bits, at least words_for(size) words.
+         *              The bits of the last word beyond size have to be zero.
+         * \param size  The number of bits
+         */
+        bitset_view(word_type words[], size_type size);
+
+        /**
+         * Copies the bits of other into this bitset.
+         *
+         * \assert{size() == other.size()}
+         */
+        bitset_view& operator=(const bitset_view& other);
+
+        /**
+         * Returns the number of bits.
+         *
+         * \complexity Constant
+         */
+        size_type size() const;
+
+        /**
+         * Returns the number of words holding the bits.
+         *
+         * \complexity Constant
+         */
+        size_type word_count() const;
+
+        /**
+         * Returns the words holding the bits, the bit at position pos is
+         * bit pos % BITS_PER_WORD of word pos / BITS_PER_WORD.
+         */
+        const word_type* data() const;
+
+        /**
+         * Returns the value of the bit at position pos.
+         *
+         * \assert{pos < size()}
+         */
+        bool test(size_type pos) const;
+
+        /**
+         * Returns the value of the bit at position pos.
+         *
+         * \assert{pos < size()}
+         */
+        bool operator[](size_type pos) const;
+
+        /**
+         * Sets all bits.
+         *
+         * \complexity Linear in word_count().
+         */
+        bitset_view& set();
+
+        /**
+         * Sets the bit at position pos to value.
+         *
+         * \assert{pos < size()}
+         * \complexity Constant
+         */
+        bitset_view& set(size_type pos, bool value = true);
+
+        /**
+         * Sets the bits in the range [first, last).
+         *
+         * \assert{first <= last && last <= size()}
+         * \complexity Linear in the number of words of the range.
+         */
+        bitset_view& set(size_type first, size_type last, bool value);
+
+        /**
+         * Clears all bits.
+         *
+         * \complexity Linear in word_count().
+         */
+        bitset_view& reset();
+
+        /**
+         * Clears the bit at position pos.
+         *
+         * \assert{pos < size()}
+         * \complexity Constant
+         */
+        bitset_view& reset(size_type pos);
+
+        /**
+         * Clears the bits in the range [first, last).
+         *
+         * \assert{first <= last && last <= size()}
+         * \complexity Linear in the number of words of the range.
+         */
+        bitset_view& reset(size_type first, size_type last);
+
+        /**
+         * Toggles all bits.
+         *
+         * \complexity Linear in word_count().
+         */
+        bitset_view& flip();
+
+        /**
+         * Toggles the bit at position pos.
+         *
+         * \assert{pos < size()}
+         * \complexity Constant
+         */
+        bitset_view& flip(size_type pos);
+
+        /**
+         * Returns the number of set bits.
+         *
+         * \complexity Linear in word_count().
+         */
+        size_type count() const;
+
+        /**
+         * Returns true if any bit is set.
+         *
+         * \complexity Linear in word_count().
+         */
+        bool any() const;
+
+        /**
+         * Returns true if no bit is set.
+         *
+         * \complexity Linear in word_count().
+         */
+        bool none() const;
+
+        /**
+         * Returns true if all bits are set.
+         *
+         * \complexity Linear in word_count().
+         */
+        bool all() const;
+
+        /**
+         * Returns the position of the first set bit, or npos.
+         *
+         * \complexity Linear in word_count().
+         */
+        size_type find_first() const;
+
+        /**
+         * Returns the position of the first set bit after pos, or npos.
+         *
+         * \complexity Linear in word_count().
+         */
+        size_type find_next(size_type pos) const;
+
+        /**
+         * Returns the position of the first cleared bit, or npos.
+         *
+         * \complexity Linear in word_count().
+         */
+        size_type find_first_unset() const;
+
+        /**
+         * Returns the position of the first cleared bit after pos, or npos.
+         *
+         * \complexity Linear in word_count().
+         */
+        size_type find_next_unset(size_type pos) const;
+
+        /**
+         * Calls f with the position of each set bit in ascending order and
+         * returns f. The bits must not be changed by f.
+         *
+         * \complexity Linear in word_count() plus count().
+         */
+        template<class Function>
+        Function for_each_set(Function f) const;
+
+        /**
+         * Keeps the bits that are also set in other.
+         *
+         * \assert{size() == other.size()}
+         */
+        bitset_view& operator&=(const bitset_view& other);
+
+        /**
+         * Sets the bits that are set in other.
+         *
+         * \assert{size() == other.size()}
+         */
+        bitset_view& operator|=(const bitset_view& other);
+
+        /**
+         * Toggles the bits that are set in other.
+         *
+         * \assert{size() == other.size()}
+         */
+        bitset_view& operator^=(const bitset_view& other);
+
+    private:
+        bitset_view(const bitset_view& other);
+
+        static word_type mask(size_type pos);
+
+        size_type find_from(size_type pos) const;
+
+        size_type find_unset_from(size_type pos) const;
+
+        void clear_unused();
+
+        word_type* _words;
+        size_type _size;
+    };
+
+    /**
+     * Returns true if both bitsets have the same size and bits.
+     */
+    bool operator==(const bitset_view& lhs, const bitset_view& rhs);
+
+    /**
+     * Returns true if the bitsets differ in size or bits.
+     */
+    bool operator!=(const bitset_view& lhs, const bitset_view& rhs);
+
+    /*
+     * namespace to declare a bitset
+     */
+    namespace declare
+    {
+
+        /**
+         * Bitset with static size, all bits are cleared initially.
+         *
+         * \tparam  N   Number of bits of this bitset.
+         */
+        template<std::size_t N>
+        class bitset
+        :   public ::esrlabs::estd::bitset_view
+        {
+        public:
+            typedef ::esrlabs::estd::bitset_view base;
+            typedef ::esrlabs::estd::declare::bitset<N> this_type;
+
+            /** The number of words holding the bits */
+            static const size_type WORDS = (N + BITS_PER_WORD - 1) / BITS_PER_WORD;
+
+            /**
+             * Constructs a bitset with all bits cleared.
+             */
+            bitset();
+
+            /**
+             * Copies the bits of other.
+             */
+            bitset(const this_type& other);
+
+            /**
+             * Copies the bits of other.
+             *
+             * \assert{other.size() == N}
+             */
+            bitset& operator=(const base& other);
+
+            /**
+             * Copies the bits of other.
+             */
+            bitset& operator=(const this_type& other);
+
+        private:
+            // at least one word to avoid an empty array
+            word_type _words[(WORDS > 0) ? WORDS : 1];
+        };
+
+    } /* namespace declare */
+
+/*
+ *
+ * Implementation of bitset_view
+ *
+ */
+
+inline
+bitset_view::size_type
+bitset_view::words_for(size_type bits)
+{
+    return (bits + BITS_PER_WORD - 1) / BITS_PER_WORD;
+}
+
+inline
+bitset_view::bitset_view(word_type words[], size_type size)
+:   _words(words)
+,   _size(size)
+{}
+
+inline
+bitset_view&
+bitset_view::operator=(const bitset_view& other)
+{
+    estd_assert(_size == other._size);
+    size_type const n = word_count();
+    for (size_type i = 0; i < n; ++i)
+    {
+        _words[i] = other._words[i];
+    }
+    return *this;
+}
+
+inline
+bitset_view::size_type
+bitset_view::size() const
+{
+    return _size;
+}
+
+inline
+bitset_view::size_type
+bitset_view::word_count() const
+{
+    return words_for(_size);
+}
+
+inline
+const bitset_view::word_type*
+bitset_view::data() const
+{
+    return _words;
+}
+
+inline
+bool
+bitset_view::test(size_type pos) const
+{
+    estd_assert(pos < _size);
+    return (_words[pos / BITS_PER_WORD] & mask(pos)) != 0;
+}
+
+inline
+bool
+bitset_view::operator[](size_type pos) const
+{
+    return test(pos);
+}
+
+inline
+bitset_view&
+bitset_view::set()
+{
+    size_type const n = word_count();
+    for (size_type i = 0; i < n; ++i)
+    {
+        _words[i] = ~static_cast<word_type>(0);
+    }
+    clear_unused();
+    return *this;
+}
+
+inline
+bitset_view&
+bitset_view::set(size_type pos, bool value)
+{
+    estd_assert(pos < _size);
+    if (value)
+    {
+        _words[pos / BITS_PER_WORD] |= mask(pos);
+    }
+    else
+    {
+        _words[pos / BITS_PER_WORD] &= ~mask(pos);
+    }
+    return *this;
+}
+
+inline
+bitset_view&
+bitset_view::set(size_type first, size_type last, bool value)
+{
+    estd_assert(first <= last);
+    estd_assert(last <= _size);
+    if (first == last)
+    {
+        return *this;
+    }
+    size_type const firstWord = first / BITS_PER_WORD;
+    size_type const lastWord = (last - 1) / BITS_PER_WORD;
+    word_type const all = ~static_cast<word_type>(0);
+    // the bits from first to the end of its word and from the start of
+    // the last word to last
+    word_type firstMask = all << (first % BITS_PER_WORD);
+    word_type const lastMask = all >> (BITS_PER_WORD - 1 - (last - 1) % BITS_PER_WORD);
+    if (firstWord == lastWord)
+    {
+        firstMask &= lastMask;
+    }
+    if (value)
+    {
+        _words[firstWord] |= firstMask;
+    }
+    else
+    {
+        _words[firstWord] &= ~firstMask;
+    }
+    if (firstWord == lastWord)
+    {
+        return *this;
+    }
+    for (size_type i = firstWord + 1; i < lastWord; ++i)
+    {
+        _words[i] = value ? all : 0;
+    }
+    if (value)
+    {
+        _words[lastWord] |= lastMask;
+    }
+    else
+    {
+        _words[lastWord] &= ~lastMask;
+    }
+    return *this;
+}
+
+inline
+bitset_view&
+bitset_view::reset()
+{
+    size_type const n = word_count();
+    for (size_type i = 0; i < n; ++i)
+    {
+        _words[i] = 0;
+    }
+    return *this;
+}
+
+inline
+bitset_view&
+bitset_view::reset(size_type pos)
+{
+    return set(pos, false);
+}
+
+inline
+bitset_view&
+bitset_view::reset(size_type first, size_type last)
+{
+    return set(first, last, false);
+}
+
+inline
+bitset_view&
+bitset_view::flip()
+{
+    size_type const n = word_count();
+    for (size_type i = 0; i < n; ++i)
+    {
+        _words[i] = ~_words[i];
+    }
+    clear_unused();
+    return *this;
+}
+
+inline
+bitset_view&
+bitset_view::flip(size_type pos)
+{
+    estd_assert(pos < _size);
+    _words[pos / BITS_PER_WORD] ^= mask(pos);
+    return *this;
+}
+
+inline
+bitset_view::size_type
+bitset_view::count() const
+{
+    size_type result = 0;
+    size_type const n = word_count();
+    for (size_type i = 0; i < n; ++i)
+    {
+        result += internal::popcount(_words[i]);
+    }
+    return result;
+}
+
+inline
+bool
+bitset_view::any() const
+{
+    return find_first() != npos;
+}
+
+inline
+bool
+bitset_view::none() const
+{
+    return find_first() == npos;
+}
+
+inline
+bool
+bitset_view::all() const
+{
+    return find_first_unset() == npos;
+}
+
+inline
+bitset_view::size_type
+bitset_view::find_first() const
+{
+    return find_from(0);
+}
+
+inline
+bitset_view::size_type
+bitset_view::find_next(size_type pos) const
+{
+    return (pos >= _size) ? npos : find_from(pos + 1);
+}
+
+inline
+bitset_view::size_type
+bitset_view::find_first_unset() const
+{
+    return find_unset_from(0);
+}
+
+inline
+bitset_view::size_type
+bitset_view::find_next_unset(size_type pos) const
+{
+    return (pos >= _size) ? npos : find_unset_from(pos + 1);
+}
+
+template<class Function>
+Function
+bitset_view::for_each_set(Function f) const
+{
+    size_type const n = word_count();
+    for (size_type i = 0; i < n; ++i)
+    {
+        word_type bits = _words[i];
+        while (bits != 0)
+        {
+            f(i * BITS_PER_WORD + internal::count_trailing_zeros(bits));
+            // clears the lowest set bit
+            bits &= bits - 1;
+        }
+    }
+    return f;
+}
+
+inline
+bitset_view&
+bitset_view::operator&=(const bitset_view& other)
+{
+    estd_assert(_size == other._size);
+    size_type const n = word_count();
+    for (size_type i = 0; i < n; ++i)
+    {
+        _words[i] &= other._words[i];
+    }
+    return *this;
+}
+
+inline
+bitset_view&
+bitset_view::operator|=(const bitset_view& other)
+{
+    estd_assert(_size == other._size);
+    size_type const n = word_count();
+    for (size_type i = 0; i < n; ++i)
+    {
+        _words[i] |= other._words[i];
+    }
+    return *this;
+}
+
+inline
+bitset_view&
+bitset_view::operator^=(const bitset_view& other)
+{
+    estd_assert(_size == other._size);
+    size_type const n = word_count();
+    for (size_type i = 0; i < n; ++i)
+    {
+        _words[i] ^= other._words[i];
+    }
+    return *this;
+}
+
+inline
+bitset_view::word_type
+bitset_view::mask(size_type pos)
+{
+    return static_cast<word_type>(1) << (pos % BITS_PER_WORD);
+}
+
+inline
+bitset_view::size_type
+bitset_view::find_from(size_type pos) const
+{
+    if (pos >= _size)
+    {
+        return npos;
+    }
+    size_type i = pos / BITS_PER_WORD;
+    size_type const n = word_count();
+    word_type bits = _words[i] & (~static_cast<word_type>(0) << (pos % BITS_PER_WORD));
+    while (bits == 0)
+    {
+        if (++i == n)
+        {
+            return npos;
+        }
+        bits = _words[i];
+    }
+    // the unused bits are zero, so the result is below size
+    return i * BITS_PER_WORD + internal::count_trailing_zeros(bits);
+}
+
+inline
+bitset_view::size_type
+bitset_view::find_unset_from(size_type pos) const
+{
+    if (pos >= _size)
+    {
+        return npos;
+    }
+    size_type i = pos / BITS_PER_WORD;
+    size_type const n = word_count();
+    word_type bits = ~_words[i] & (~static_cast<word_type>(0) << (pos % BITS_PER_WORD));
+    while (bits == 0)
+    {
+        if (++i == n)
+        {
+            return npos;
+        }
+        bits = ~_words[i];
+    }
+    // the unused bits of the last word are zero and therefore found here
+    size_type const result = i * BITS_PER_WORD + internal::count_trailing_zeros(bits);
+    return (result < _size) ? result : npos;
+}
+
+inline
+void
+bitset_view::clear_unused()
+{
+    size_type const used = _size % BITS_PER_WORD;
+    if (used != 0)
+    {
+        _words[_size / BITS_PER_WORD] &= mask(used) - 1;
+    }
+}
+
+inline
+bool
+operator==(const bitset_view& lhs, const bitset_view& rhs)
+{
+    if (lhs.size() != rhs.size())
+    {
+        return false;
+    }
+    bitset_view::size_type const n = lhs.word_count();
+    for (bitset_view::size_type i = 0; i < n; ++i)
+    {
+        if (lhs.data()[i] != rhs.data()[i])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+inline
+bool
+operator!=(const bitset_view& lhs, const bitset_view& rhs)
+{
+    return !(lhs == rhs);
+}
+
+namespace declare
+{
+
+    template<std::size_t N>
+    bitset<N>::bitset()
+    :   base(_words, N)
+    ,   _words()
+    {}
+
+    template<std::size_t N>
+    bitset<N>::bitset(const this_type& other)
+    :   base(_words, N)
+    ,   _words()
+    {
+        base::operator=(other);
+    }
+
+    template<std::size_t N>
+    bitset<N>&
+    bitset<N>::operator=(const base& other)
+    {
+        base::operator=(other);
+        return *this;
+    }
+
+    template<std::size_t N>
+    bitset<N>&
+    bitset<N>::operator=(const this_type& other)
+    {
+        base::operator=(other);
+        return *this;
+    }
+
+} /* namespace declare */
+
+} /* namespace estd */
+
+} /* namespace esrlabs */
+
+#endif /* ESTD_BITSET_H */
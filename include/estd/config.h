@@ -14,4 +14,12 @@
 
 #define ESTD_EXCEPTION_LIKE_CALLBACKS 1
 
+/*
+ * Size of a cache line of the target. Used to separate data that is
+ * accessed from different cores.
+ */
+#ifndef ESTD_CACHE_LINE_SIZE
+#  define ESTD_CACHE_LINE_SIZE 64
+#endif
+
 #endif
@@ -8,4 +8,48 @@
 #define HAS_STDINT_H_
 //#define HAS_CSTDINT_H_
 
+/*
+ * Compiler intrinsics used by the type traits.
+ */
+#if (__GNUC__ > 4) || ((__GNUC__ == 4) && (__GNUC_MINOR__ >= 3)) || defined(__clang__)
+#  define ESTD_IS_POD(T) __is_pod(T)
+#  define ESTD_IS_ENUM(T) __is_enum(T)
+#endif
+
+#if (__GNUC__ >= 5) || defined(__clang__)
+#  define ESTD_IS_TRIVIALLY_COPYABLE(T) __is_trivially_copyable(T)
+#endif
+
+/*
+ * Alignment support.
+ */
+#define ESTD_ALIGNOF(T) __alignof__(T)
+#define ESTD_ALIGNED(N) __attribute__((aligned(N)))
+
+/*
+ * Atomic operations, see estd/atomic.h
+ */
+#if (__GNUC__ > 4) || ((__GNUC__ == 4) && (__GNUC_MINOR__ >= 7)) || defined(__clang__)
+#  define ESTD_HAS_ATOMIC_BUILTINS
+#endif
+
+/*
+ * Bit scan and population count of words, see estd/bitset.h
+ */
+#define ESTD_HAS_BIT_BUILTINS
+
+/*
+ * Vector instructions used by the search algorithms, see estd/algorithm.h.
+ * They are selected by the target flags of the compiler, e.g. -mavx2, and
+ * can be turned off by defining ESTL_NO_SIMD.
+ */
+#if !defined(ESTL_NO_SIMD)
+#  if defined(__SSE2__)
+#    define ESTD_HAS_SSE2
+#  endif
+#  if defined(__AVX2__)
+#    define ESTD_HAS_AVX2
+#  endif
+#endif
+
 #endif /* estd_config_gnu_h_ */
@@ -8,6 +8,9 @@
 #define ESTD_CONSTRUCTOR_H
 
 #include <estd/estdint.h>
+#if __cplusplus >= 201103L
+#include <utility>
+#endif
 
 namespace esrlabs {
 namespace estd {
@@ -47,6 +50,20 @@ namespace estd {
          */
         constructor(uint8_t mem[]);
 
+#if __cplusplus >= 201103L
+        /**
+         * Constructs an object of type T by calling the constructor
+         * matching the given arguments, which are perfectly forwarded, so
+         * rvalues are moved and no argument is copied on the way.
+         * Uses placement new to construct the object into the memory
+         * passed in the constructor.
+         *
+         * \param args The parameters to pass to the constructor.
+         * \return A newly created object.
+         */
+        template<class... Args>
+        T& construct(Args&&... args);
+#else
         /**
          * Constructs an object of type T with the default constructor.
          * Uses placement new to construct the object into the memory
@@ -135,6 +152,7 @@ namespace estd {
          */
         template<class P1, class P2, class P3, class P4, class P5>
         T& construct(P1 p1, P2 p2, P3 p3, P4 p4, P5 p5);
+#endif
 
         /**
          * Cast operator for the underlying memory. This can
@@ -159,6 +177,15 @@ constructor<T>::constructor(uint8_t mem[])
 {}
 
 
+#if __cplusplus >= 201103L
+template<class T>
+template<class... Args>inline
+T&
+constructor<T>::construct(Args&&... args)
+{
+    return *new (_memory)T(std::forward<Args>(args)...);
+}
+#else
 template<class T>inline
 T&
 constructor<T>::construct()
@@ -213,6 +240,7 @@ constructor<T>::construct(P1 p1, P2 p2, P3 p3, P4 p4, P5 p5)
 {
     return *new (_memory)T(p1, p2, p3, p4, p5);
 }
+#endif
 
 template<class T>inline
 constructor<T>::operator uint8_t*()
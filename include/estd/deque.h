@@ -0,0 +1,1042 @@
+/**
+ * Contains esrlabs::estd::deque and esrlabs::estd::declare::deque.
+ * \file
+ * \ingroup estl
+ * \copyright   E.S.R.Labs AG, 2014, All rights reserved.
+ */
+#ifndef ESTD_DEQUE_H
+#define ESTD_DEQUE_H
+
+#include <algorithm>
+#include <iterator>
+#include <new>
+#include <estd/assert.h>
+#include <estd/type_traits.h>
+#include <estd/constructor.h>
+#include <estd/usage.h>
+
+namespace esrlabs {
+namespace estd {
+
+    namespace internal
+    {
+        /// \cond INTERNAL
+        template<class T, class Container, class Reference, class Pointer>
+        class deque_iterator;
+        /// \endcond
+    } /* namespace internal */
+
+    /**
+     * A fixed-sized STL like double ended queue. The elements are stored in
+     * a ring buffer, so adding and removing elements at both ends takes
+     * constant time and never moves other elements.
+     *
+     * \tparam  T   Type of values of this deque.
+     *
+     * \section deque_fifo_example Usage example
+     * \code{.cpp}
+     * void produce(esrlabs::estd::deque<Sample>& fifo, const Sample& s)
+     * {
+     *     if (!fifo.full())
+     *     {
+     *         fifo.push_back(s);
+     *     }
+     * }
+     *
+     * void consume(esrlabs::estd::deque<Sample>& fifo)
+     * {
+     *     while (!fifo.empty())
+     *     {
+     *         process(fifo.front());
+     *         fifo.pop_front();
+     *     }
+     * }
+     * \endcode
+     *
+     * This container supports adding objects of type T that do not have
+     * a copy constructor or default constructor. Use the emplace methods
+     * to create an instance of T directly into the deque.
+     *
+     * \see esrlabs::estd::declare::deque
+     * \see esrlabs::estd::constructor
+     */
+    template<class T>
+    class deque
+    {
+    public:
+        /** The template parameter T */
+        typedef T              value_type;
+        /** A reference to the template parameter T */
+        typedef T&             reference;
+        /** A const reference to the template parameter T */
+        typedef const T&       const_reference;
+        /** A pointer to the template parameter T */
+        typedef T*             pointer;
+        /** A const pointer to the template parameter T */
+        typedef const T*       const_pointer;
+        /** An unsigned integral type for the size */
+        typedef std::size_t    size_type;
+        /** A signed integral type */
+        typedef std::ptrdiff_t difference_type;
+        /** A random access iterator */
+        typedef internal::deque_iterator<T, deque<T>, T&, T*> iterator;
+        /** A const random access iterator */
+        typedef internal::deque_iterator<T, const deque<T>, const T&, const T*> const_iterator;
+        /** A random access reverse iterator */
+        typedef std::reverse_iterator<iterator> reverse_iterator;
+        /** A const random access reverse iterator */
+        typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+        /**
+         * A simple destructor. This destructor does not call the contained
+         * object destructors. The derived class deque will call the destructors
+         * on any objects in the deque.
+         */
+        ~deque();
+
+        /**
+         * An assignment operator. Copies values from other to this. Replacing all
+         * values in this deque.
+         *
+         * \param other The other deque to copy.
+         * \return A reference to this.
+         */
+        deque<T>& operator=(const deque<T>& other);
+
+        /**
+         * Replaces any element currently in this container and fills it with n
+         * elements which all are initialized with a copy of value.
+         *
+         * \param n The number of elements to add
+         * \param value The value to copy into this container.
+         * \complexity  Linear in the number of elements added.
+         *
+         * \note
+         * If n > max_size(), only max_size() elements will be added.
+         */
+        void assign(size_type n, const_reference value);
+
+        /**
+         * Replaces any element currently in this container and fills it with the
+         * elements in [first, last).
+         *
+         * \param first The beginning iterator.
+         * \param last The ending iterator.
+         * \complexity  Linear in the number of elements added.
+         *
+         * \note
+         * At most max_size() elements will be added.
+         */
+        template<class InputIterator>
+        typename enable_if<!is_integral<InputIterator>::value, void>::type
+        assign(
+            InputIterator first,
+            InputIterator last);
+
+        /**
+         * Returns current size of this deque.
+         *
+         * \complexity Constant
+         */
+        size_type size() const;
+
+        /**
+         * Returns maximum number of elements this deque can hold.
+         *
+         * \complexity Constant
+         */
+        size_type max_size() const;
+
+        /**
+         *  Returns whether this deque is empty or not.
+         *
+         *  \return
+         *  - true if size() == 0
+         *  - false otherwise
+         *  \complexity Constant
+         */
+        bool empty() const;
+
+        /**
+         *  Returns true if the deque is full.
+         *
+         *  \return
+         *  - true if size() == max_size()
+         *  - false otherwise
+         *  \complexity Constant
+         */
+        bool full() const;
+
+        /**
+         * Returns a reference to the element at position index in this deque.
+         *
+         * \param index An index into this deque.
+         * \return A reference to the requested element.
+         * \note
+         * No bounds checking is done.
+         */
+        reference operator[](size_type index);
+
+        /**
+         * Returns a const reference to the element at position index in this deque.
+         *
+         * \param index An index into this deque.
+         * \return A const reference to the requested element.
+         * \note
+         * No bounds checking is done.
+         */
+        const_reference operator[](size_type index) const;
+
+        /**
+         * Returns a reference to the element at position index in this deque.
+         *
+         * \param index An index into this deque.
+         * \return A reference to the requested element.
+         * \assert{index < size()}
+         */
+        reference at(size_type index);
+
+        /**
+         * Returns a const reference to the element at position index in this deque.
+         *
+         * \param index An index into this deque.
+         * \return A const reference to the requested element.
+         * \assert{index < size()}
+         */
+        const_reference at(size_type index) const;
+
+        /**
+         * Returns a reference to the first element of this deque.
+         *
+         * \assert{!empty()}
+         * \complexity  Constant.
+         */
+        reference front();
+
+        /**
+         * Returns a const reference to the first element of this deque.
+         *
+         * \assert{!empty()}
+         * \complexity  Constant.
+         */
+        const_reference front() const;
+
+        /**
+         * Returns a reference to the last element of this deque.
+         *
+         * \assert{!empty()}
+         * \complexity  Constant.
+         */
+        reference back();
+
+        /**
+         * Returns a const reference to the last element of this deque.
+         *
+         * \assert{!empty()}
+         * \complexity  Constant.
+         */
+        const_reference back() const;
+
+        /**
+         * Default constructs an element at the end of this deque and
+         * returns a reference to it increasing this deque's size by one.
+         *
+         * \return A reference to the newly created object.
+         * \assert{!full()}
+         * \complexity  Constant.
+         */
+        reference push_back();
+
+        /**
+         * Copy constructs an element at the end of this deque from a
+         * given value increasing this deque's size by one.
+         *
+         * \param value The value to copy into this deque.
+         * \assert{!full()}
+         * \complexity  Constant.
+         */
+        void push_back(const_reference value);
+
+        /**
+         * Returns a constructor object to the memory allocated at the end
+         * of this deque increasing this deque's size by one.
+         *
+         * \return A constructor object that can be used to initialize an object.
+         * \assert{!full()}
+         * \complexity  Constant.
+         */
+        constructor<T> emplace_back();
+
+        /**
+         * Default constructs an element at the beginning of this deque and
+         * returns a reference to it increasing this deque's size by one.
+         *
+         * \return A reference to the newly created object.
+         * \assert{!full()}
+         * \complexity  Constant.
+         */
+        reference push_front();
+
+        /**
+         * Copy constructs an element at the beginning of this deque from a
+         * given value increasing this deque's size by one.
+         *
+         * \param value The value to copy into this deque.
+         * \assert{!full()}
+         * \complexity  Constant.
+         */
+        void push_front(const_reference value);
+
+        /**
+         * Returns a constructor object to the memory allocated at the beginning
+         * of this deque increasing this deque's size by one.
+         *
+         * \return A constructor object that can be used to initialize an object.
+         * \assert{!full()}
+         * \complexity  Constant.
+         */
+        constructor<T> emplace_front();
+
+        /**
+         *  Removes the last element and destroys it.
+         *
+         *  \assert{!empty()}
+         *  \complexity  Constant.
+         */
+        void pop_back();
+
+        /**
+         *  Removes the first element and destroys it.
+         *
+         *  \assert{!empty()}
+         *  \complexity  Constant.
+         */
+        void pop_front();
+
+        /**
+         *  Clears the deque. All elements will be destroyed.
+         */
+        void clear();
+
+        /** Returns an iterator to the beginning */
+        iterator begin();
+
+        /** Returns a const iterator to the beginning */
+        const_iterator begin() const;
+
+        /** Returns a const iterator to the beginning */
+        const_iterator cbegin() const;
+
+        /** Returns an iterator to the end */
+        iterator end();
+
+        /** Returns a const iterator to the end */
+        const_iterator end() const;
+
+        /** Returns a const iterator to the end */
+        const_iterator cend() const;
+
+        /**
+         * Returns a reverse iterator pointing to the last element in the deque
+         * (i.e., its reverse beginning). Reverse iterators iterate backwards.
+         */
+        reverse_iterator rbegin();
+
+        /**
+         * Returns a const reverse iterator pointing to the last element in the deque
+         * (i.e., its reverse beginning). Reverse iterators iterate backwards.
+         */
+        const_reverse_iterator rbegin() const;
+
+        /**
+         * Returns a const reverse iterator pointing to the last element in the deque
+         * (i.e., its reverse beginning). Reverse iterators iterate backwards.
+         */
+        const_reverse_iterator crbegin() const;
+
+        /**
+         * Returns a reverse iterator pointing to the first element in the deque
+         * (i.e., its reverse end). Reverse iterators iterate backwards.
+         */
+        reverse_iterator rend();
+
+        /**
+         * Returns a const reverse iterator pointing to the first element in the deque
+         * (i.e., its reverse end). Reverse iterators iterate backwards.
+         */
+        const_reverse_iterator rend() const;
+
+        /**
+         * Returns a const reverse iterator pointing to the first element in the deque
+         * (i.e., its reverse end). Reverse iterators iterate backwards.
+         */
+        const_reverse_iterator crend() const;
+
+#if defined(ESTL_TRACK_USAGE)
+        /**
+         * Returns the usage statistics of this deque.
+         */
+        container_usage& usage();
+
+        /**
+         * Returns the usage statistics of this deque.
+         */
+        const container_usage& usage() const;
+#endif
+
+    protected:
+
+        /**
+         * Constructor to initialize this deque with the actual data to work with.
+         * Used by the declare class. If the resulting capacity is a power of two,
+         * indices are wrapped by masking.
+         *
+         * \param data The actual data for this deque
+         * \param size The size of the data array
+         */
+        deque(uint8_t data[], size_type size);
+
+    private:
+
+        // private and not defined
+        deque(const deque<T>& other);
+
+        uint8_t* _data;
+        size_type _max_size;
+        size_type _mask;
+        size_type _head;
+        size_type _size;
+#if defined(ESTL_TRACK_USAGE)
+        container_usage _usage;
+#endif
+
+        size_type physical(size_type index) const;
+
+        T* slot(size_type index) const;
+    };
+
+    /**
+     * Compares two deques and returns true if they are identical.
+     *
+     * Requires T to have operator== defined.
+     */
+    template<class T>
+    bool
+    operator==(const deque<T>& lhs, const deque<T>& rhs);
+
+    /**
+     * Compares two deques and returns true if they are not identical.
+     *
+     * Requires T to have operator== defined.
+     */
+    template<class T>
+    bool
+    operator!=(const deque<T>& lhs, const deque<T>& rhs);
+
+    namespace internal
+    {
+        /// \cond INTERNAL
+        /*
+         * Random access iterator of a deque. Stores the logical index of
+         * the element, the wrap around is handled by the deque.
+         */
+        template<class T, class Container, class Reference, class Pointer>
+        class deque_iterator
+        {
+        public:
+            typedef std::random_access_iterator_tag iterator_category;
+            typedef T                               value_type;
+            typedef std::ptrdiff_t                  difference_type;
+            typedef Pointer                         pointer;
+            typedef Reference                       reference;
+
+            deque_iterator() : _deque(0L), _index(0) {}
+
+            deque_iterator(Container* d, std::size_t index) : _deque(d), _index(index) {}
+
+            // conversion from iterator to const_iterator
+            template<class C, class R, class P>
+            deque_iterator(const deque_iterator<T, C, R, P>& other)
+            :   _deque(other._deque)
+            ,   _index(other._index)
+            {}
+
+            reference operator*() const { return (*_deque)[_index]; }
+            pointer operator->() const { return &(*_deque)[_index]; }
+            reference operator[](difference_type n) const { return (*_deque)[_index + n]; }
+
+            deque_iterator& operator++() { ++_index; return *this; }
+            deque_iterator operator++(int) { deque_iterator tmp(*this); ++_index; return tmp; }
+            deque_iterator& operator--() { --_index; return *this; }
+            deque_iterator operator--(int) { deque_iterator tmp(*this); --_index; return tmp; }
+            deque_iterator& operator+=(difference_type n) { _index += n; return *this; }
+            deque_iterator& operator-=(difference_type n) { _index -= n; return *this; }
+            deque_iterator operator+(difference_type n) const { return deque_iterator(_deque, _index + n); }
+            deque_iterator operator-(difference_type n) const { return deque_iterator(_deque, _index - n); }
+
+            template<class C, class R, class P>
+            difference_type operator-(const deque_iterator<T, C, R, P>& other) const
+            { return static_cast<difference_type>(_index) - static_cast<difference_type>(other._index); }
+
+            template<class C, class R, class P>
+            bool operator==(const deque_iterator<T, C, R, P>& other) const { return _index == other._index; }
+            template<class C, class R, class P>
+            bool operator!=(const deque_iterator<T, C, R, P>& other) const { return _index != other._index; }
+            template<class C, class R, class P>
+            bool operator<(const deque_iterator<T, C, R, P>& other) const { return _index < other._index; }
+            template<class C, class R, class P>
+            bool operator>(const deque_iterator<T, C, R, P>& other) const { return _index > other._index; }
+            template<class C, class R, class P>
+            bool operator<=(const deque_iterator<T, C, R, P>& other) const { return _index <= other._index; }
+            template<class C, class R, class P>
+            bool operator>=(const deque_iterator<T, C, R, P>& other) const { return _index >= other._index; }
+
+        private:
+            template<class, class, class, class> friend class deque_iterator;
+
+            Container* _deque;
+            std::size_t _index;
+        };
+
+        template<class T, class C, class R, class P>inline
+        deque_iterator<T, C, R, P>
+        operator+(std::ptrdiff_t n, const deque_iterator<T, C, R, P>& i)
+        {
+            return i + n;
+        }
+        /// \endcond
+    } /* namespace internal */
+
+    /*
+     * namespace to declare a deque
+     */
+    namespace declare
+    {
+
+        /**
+         * STL like deque with static size. Choosing a power of two for N
+         * replaces the wrap around comparison by a mask operation.
+         *
+         * \tparam  T   Type of values of this deque.
+         * \tparam  N   Maximum number of values in this deque.
+         */
+        template<class T, std::size_t N>
+        class deque
+        :   public ::esrlabs::estd::deque<T>
+        {
+        public:
+            typedef ::esrlabs::estd::deque<T> base;
+            typedef ::esrlabs::estd::declare::deque<T, N> this_type;
+
+            /** The template parameter T */
+            typedef typename base::value_type      value_type;
+            /** A reference to the template parameter T */
+            typedef typename base::reference       reference;
+            /** A const reference to the template parameter T */
+            typedef typename base::const_reference const_reference;
+            /** A pointer to the template parameter T */
+            typedef typename base::pointer         pointer;
+            /** A const pointer to the template parameter T */
+            typedef typename base::const_pointer   const_pointer;
+            /** An unsigned integral type for the size */
+            typedef typename base::size_type       size_type;
+            /** A signed integral type */
+            typedef typename base::difference_type difference_type;
+            /** A random access iterator */
+            typedef typename base::iterator        iterator;
+            /** A const random access iterator */
+            typedef typename base::const_iterator  const_iterator;
+            /** A random access reverse iterator */
+            typedef typename base::reverse_iterator  reverse_iterator;
+            /** A const random access reverse iterator */
+            typedef typename base::const_reverse_iterator  const_reverse_iterator;
+
+            /**
+             * Constructs an empty deque.
+             */
+            deque();
+
+            /**
+             * Constructs a deque with n elements initialized to a given value v.
+             */
+            deque(size_type n, const_reference value = value_type());
+
+            /**
+             * Copies the values of the other deque into this deque.
+             */
+            deque(const base& other);
+
+            /**
+             * Copies the values of the other deque into this deque.
+             */
+            deque(const this_type& other);
+
+            /**
+             * Calls the destructor on all contained objects.
+             */
+            ~deque();
+
+            /**
+             * Copies the values of the other deque into this deque.
+             */
+            deque& operator=(const base& other);
+
+            /**
+             * Copies the values of the other deque into this deque.
+             */
+            deque& operator=(const this_type& other);
+
+        private:
+            typename aligned_storage<sizeof(T) * N, alignment_of<T>::value>::type _data;
+        };
+
+    } /* namespace declare */
+
+template<class T>inline
+bool
+operator==(const deque<T>& x, const deque<T>& y)
+{
+    return (x.size() == y.size())
+            && std::equal(x.begin(), x.end(), y.begin());
+}
+
+template<class T>inline
+bool
+operator!=(const deque<T>& x, const deque<T>& y)
+{
+    return !(x == y);
+}
+
+/*
+ *
+ * Implementation of deque
+ *
+ */
+
+template<class T>
+deque<T>::deque(uint8_t data[], size_type size)
+:   _data(data)
+,   _max_size(size / sizeof(T))
+,   _mask(0)
+,   _head(0)
+,   _size(0)
+#if defined(ESTL_TRACK_USAGE)
+,   _usage("deque", sizeof(T), size / sizeof(T))
+#endif
+{
+    if ((_max_size > 1) && ((_max_size & (_max_size - 1)) == 0))
+    {
+        _mask = _max_size - 1;
+    }
+}
+
+template<class T>
+deque<T>::~deque()
+{
+
+}
+
+template<class T>
+deque<T>&
+deque<T>::operator=(const deque<T>& other)
+{
+    // identical deque
+    if(_data == other._data)
+    {
+        return *this;
+    }
+
+    estd_assert(_max_size >= other._size);
+
+    assign(other.begin(), other.end());
+    return *this;
+}
+
+template<class T>inline
+void
+deque<T>::assign(size_type n, const_reference value)
+{
+    clear();
+    n = std::min(n, max_size());
+    while (n > 0)
+    {
+        emplace_back().construct(value);
+        --n;
+    }
+}
+
+template<class T>
+template<class InputIterator>inline
+typename enable_if
+<   !is_integral<InputIterator>::value
+,   void
+>::type
+deque<T>::assign(InputIterator first, InputIterator last)
+{
+    clear();
+    while (!full() && (first != last))
+    {
+        emplace_back().construct(*first);
+        ++first;
+    }
+}
+
+template<class T>inline
+typename deque<T>::size_type
+deque<T>::physical(size_type index) const
+{
+    size_type const i = _head + index;
+    if (_mask != 0)
+    {
+        return i & _mask;
+    }
+    // _head and index are both smaller than _max_size
+    return (i >= _max_size) ? (i - _max_size) : i;
+}
+
+template<class T>inline
+T*
+deque<T>::slot(size_type index) const
+{
+    return reinterpret_cast<T*>(&_data[sizeof(T) * physical(index)]);
+}
+
+template<class T>inline
+typename deque<T>::size_type
+deque<T>::size() const
+{
+    return _size;
+}
+
+template<class T>inline
+typename deque<T>::size_type
+deque<T>::max_size() const
+{
+    return _max_size;
+}
+
+template<class T>inline
+bool
+deque<T>::empty() const
+{
+    return (0 == _size);
+}
+
+template<class T>inline
+bool
+deque<T>::full() const
+{
+    return (_size == _max_size);
+}
+
+template<class T>inline
+typename deque<T>::reference
+deque<T>::operator[](size_type index)
+{
+    return *slot(index);
+}
+
+template<class T>inline
+typename deque<T>::const_reference
+deque<T>::operator[](size_type index) const
+{
+    return *slot(index);
+}
+
+template<class T>inline
+typename deque<T>::reference
+deque<T>::at(size_type index)
+{
+    estd_assert(index < size());
+    return *slot(index);
+}
+
+template<class T>inline
+typename deque<T>::const_reference
+deque<T>::at(size_type index) const
+{
+    estd_assert(index < size());
+    return *slot(index);
+}
+
+template<class T>inline
+typename deque<T>::reference
+deque<T>::front()
+{
+    estd_assert(size() > 0);
+    return *slot(0);
+}
+
+template<class T>inline
+typename deque<T>::const_reference
+deque<T>::front() const
+{
+    estd_assert(size() > 0);
+    return *slot(0);
+}
+
+template<class T>inline
+typename deque<T>::reference
+deque<T>::back()
+{
+    estd_assert(size() > 0);
+    return *slot(_size - 1);
+}
+
+template<class T>inline
+typename deque<T>::const_reference
+deque<T>::back() const
+{
+    estd_assert(size() > 0);
+    return *slot(_size - 1);
+}
+
+template<class T>inline
+typename deque<T>::reference
+deque<T>::push_back()
+{
+    estd_assert(!full());
+    reference value = *new(slot(_size++))T();
+    estd_track_insert(_usage, _size, 1);
+    return value;
+}
+
+template<class T>inline
+void
+deque<T>::push_back(const_reference value)
+{
+    estd_assert(!full());
+    (void)*new(slot(_size++))T(value);
+    estd_track_insert(_usage, _size, 1);
+}
+
+template<class T>inline
+constructor<T>
+deque<T>::emplace_back()
+{
+    estd_assert(!full());
+    T* const memory = slot(_size++);
+    estd_track_insert(_usage, _size, 1);
+    return constructor<T>(reinterpret_cast<uint8_t*>(memory));
+}
+
+#if defined(ESTL_TRACK_USAGE)
+template<class T>inline
+container_usage&
+deque<T>::usage()
+{
+    return _usage;
+}
+
+template<class T>inline
+const container_usage&
+deque<T>::usage() const
+{
+    return _usage;
+}
+#endif
+
+template<class T>inline
+typename deque<T>::reference
+deque<T>::push_front()
+{
+    return emplace_front().construct();
+}
+
+template<class T>inline
+void
+deque<T>::push_front(const_reference value)
+{
+    (void)emplace_front().construct(value);
+}
+
+template<class T>inline
+constructor<T>
+deque<T>::emplace_front()
+{
+    estd_assert(!full());
+    _head = (_head == 0) ? (_max_size - 1) : (_head - 1);
+    ++_size;
+    estd_track_insert(_usage, _size, 1);
+    return constructor<T>(reinterpret_cast<uint8_t*>(slot(0)));
+}
+
+template<class T>inline
+void
+deque<T>::pop_back()
+{
+    estd_assert(size() > 0);
+    slot(--_size)->~T();
+    estd_track_erase(_usage, 1);
+}
+
+template<class T>inline
+void
+deque<T>::pop_front()
+{
+    estd_assert(size() > 0);
+    slot(0)->~T();
+    _head = physical(1);
+    --_size;
+    estd_track_erase(_usage, 1);
+}
+
+template<class T>inline
+void
+deque<T>::clear()
+{
+    for (size_type i = 0; i < _size; ++i)
+    {
+        slot(i)->~T();
+    }
+    estd_track_erase(_usage, _size);
+    _head = 0;
+    _size = 0;
+}
+
+template<class T>inline
+typename deque<T>::iterator
+deque<T>::begin()
+{
+    return iterator(this, 0);
+}
+
+template<class T>inline
+typename deque<T>::const_iterator
+deque<T>::begin() const
+{
+    return const_iterator(this, 0);
+}
+
+template<class T>inline
+typename deque<T>::const_iterator
+deque<T>::cbegin() const
+{
+    return begin();
+}
+
+template<class T>inline
+typename deque<T>::iterator
+deque<T>::end()
+{
+    return iterator(this, _size);
+}
+
+template<class T>inline
+typename deque<T>::const_iterator
+deque<T>::end() const
+{
+    return const_iterator(this, _size);
+}
+
+template<class T>inline
+typename deque<T>::const_iterator
+deque<T>::cend() const
+{
+    return end();
+}
+
+template<class T>inline
+typename deque<T>::reverse_iterator
+deque<T>::rbegin()
+{
+    return reverse_iterator(end());
+}
+
+template<class T>inline
+typename deque<T>::const_reverse_iterator
+deque<T>::rbegin() const
+{
+    return const_reverse_iterator(end());
+}
+
+template<class T>inline
+typename deque<T>::const_reverse_iterator
+deque<T>::crbegin() const
+{
+    return rbegin();
+}
+
+template<class T>inline
+typename deque<T>::reverse_iterator
+deque<T>::rend()
+{
+    return reverse_iterator(begin());
+}
+
+template<class T>inline
+typename deque<T>::const_reverse_iterator
+deque<T>::rend() const
+{
+    return const_reverse_iterator(begin());
+}
+
+template<class T>inline
+typename deque<T>::const_reverse_iterator
+deque<T>::crend() const
+{
+    return rend();
+}
+
+namespace declare
+{
+
+    template<class T, std::size_t N>
+    deque<T, N>::deque()
+    :   ::esrlabs::estd::deque<T>(_data.data, sizeof(T) * N)
+    ,   _data()
+    {}
+
+    template<class T, std::size_t N>
+    deque<T, N>::deque(size_type n, const_reference value)
+    :   ::esrlabs::estd::deque<T>(_data.data, sizeof(T) * N)
+    ,   _data()
+    {
+        base::assign(n, value);
+    }
+
+    template<class T, std::size_t N>
+    deque<T, N>::deque(const base& other)
+    :   ::esrlabs::estd::deque<T>(_data.data, sizeof(T) * N)
+    ,   _data()
+    {
+        base::operator=(other);
+    }
+
+    template<class T, std::size_t N>
+    deque<T, N>::deque(const this_type& other)
+    :   ::esrlabs::estd::deque<T>(_data.data, sizeof(T) * N)
+    ,   _data()
+    {
+        base::operator=(other);
+    }
+
+    template<class T, std::size_t N>
+    deque<T, N>::~deque()
+    {
+        base::clear();
+    }
+
+    template<class T, std::size_t N>
+    deque<T, N>&
+    deque<T, N>::operator=(const base& other)
+    {
+        base::operator=(other);
+        return *this;
+    }
+
+    template<class T, std::size_t N>
+    deque<T, N>&
+    deque<T, N>::operator=(const this_type& other)
+    {
+        base::operator=(other);
+        return *this;
+    }
+
+} /* namespace declare */
+
+} /* namespace estd */
+
+} /* namespace esrlabs */
+
+#endif
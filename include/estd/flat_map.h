@@ -0,0 +1,328 @@
+/**
+ * Contains esrlabs::estd::flat_map and esrlabs::estd::declare::flat_map.
+ * \file
+ * \ingroup estl
+ * \copyright   E.S.R.Labs AG, 2014, All rights reserved.
+ */
+#ifndef ESTD_FLAT_MAP_H
+#define ESTD_FLAT_MAP_H
+
+#include <functional>
+#include <utility>
+#include <estd/assert.h>
+#include <estd/flat_tree.h>
+#include <estd/vector.h>
+
+namespace esrlabs {
+namespace estd {
+
+    /**
+     * A fixed-sized map storing its elements sorted by key in a vector.
+     *
+     * Lookups are binary searches over contiguous memory, which makes the
+     * flat_map a good fit for tables that are filled once and read often.
+     * Inserting a single element shifts all elements with greater keys, so
+     * ranges of elements should be inserted at once using
+     * insert(first, last), which sorts and merges them only once. Ranges
+     * which are already sorted and free of duplicate keys can be passed
+     * together with sorted_unique to skip sorting.
+     *
+     * Unlike std::map, the elements are of type std::pair<Key, T>, so they
+     * can be moved within the vector. Keys must not be modified through
+     * iterators, since this breaks the order of the map.
+     *
+     * \tparam  Key         Type of the keys.
+     * \tparam  T           Type of the mapped values.
+     * \tparam  Compare     Function object ordering the keys.
+     *
+     * \section flat_map_example Usage example
+     * \code{.cpp}
+     * typedef std::pair<uint16_t, const char*> Entry;
+     *
+     * static const Entry DTC_NAMES[] = {
+     *     Entry(0x0100, "MAF circuit"),
+     *     Entry(0x0300, "Random misfire"),
+     *     Entry(0x0420, "Catalyst efficiency") };
+     *
+     * esrlabs::estd::declare::flat_map<uint16_t, const char*, 64> dtcNames(
+     *     esrlabs::estd::sorted_unique, DTC_NAMES, DTC_NAMES + 3);
+     *
+     * const char* name(uint16_t dtc)
+     * {
+     *     esrlabs::estd::flat_map<uint16_t, const char*>::const_iterator i = dtcNames.find(dtc);
+     *     return (i != dtcNames.end()) ? i->second : "unknown";
+     * }
+     * \endcode
+     *
+     * \see esrlabs::estd::declare::flat_map
+     */
+    template<class Key, class T, class Compare = std::less<Key> >
+    class flat_map
+    :   public internal::flat_tree<
+            std::pair<Key, T>, Key, internal::select_first<std::pair<Key, T> >, Compare>
+    {
+        typedef internal::flat_tree<
+            std::pair<Key, T>, Key, internal::select_first<std::pair<Key, T> >, Compare> tree;
+
+    public:
+        /** The type of the keys */
+        typedef typename tree::key_type               key_type;
+        /** The type of the mapped values */
+        typedef T                                     mapped_type;
+        /** The type of the elements */
+        typedef typename tree::value_type             value_type;
+        /** The function object ordering the keys */
+        typedef typename tree::key_compare            key_compare;
+        /** The function object ordering the elements by their keys */
+        typedef typename tree::value_compare          value_compare;
+        /** A reference to an element */
+        typedef typename tree::reference              reference;
+        /** A const reference to an element */
+        typedef typename tree::const_reference        const_reference;
+        /** A pointer to an element */
+        typedef typename tree::pointer                pointer;
+        /** A const pointer to an element */
+        typedef typename tree::const_pointer          const_pointer;
+        /** An unsigned integral type for the size */
+        typedef typename tree::size_type              size_type;
+        /** A signed integral type */
+        typedef typename tree::difference_type        difference_type;
+        /** A random access iterator */
+        typedef typename tree::iterator               iterator;
+        /** A const random access iterator */
+        typedef typename tree::const_iterator         const_iterator;
+        /** A random access reverse iterator */
+        typedef typename tree::reverse_iterator       reverse_iterator;
+        /** A const random access reverse iterator */
+        typedef typename tree::const_reverse_iterator const_reverse_iterator;
+
+        /**
+         * Copies the elements of the other map into this map.
+         */
+        flat_map& operator=(const flat_map& other);
+
+        /**
+         * Returns a reference to the value mapped to the given key.
+         *
+         * \assert{count(key) == 1}
+         * \complexity Logarithmic
+         */
+        mapped_type& at(const key_type& key);
+
+        /**
+         * Returns a reference to the value mapped to the given key.
+         *
+         * \assert{count(key) == 1}
+         * \complexity Logarithmic
+         */
+        const mapped_type& at(const key_type& key) const;
+
+        /**
+         * Returns a reference to the value mapped to the given key. A default
+         * constructed value is inserted if the key is not in the map.
+         *
+         * \assert{count(key) == 1 || !full()}
+         */
+        mapped_type& operator[](const key_type& key);
+
+    protected:
+        /**
+         * Constructor to initialize this map with the vector to work with.
+         * Used by the declare class.
+         */
+        flat_map(vector<value_type>& values, const Compare& comp);
+
+    private:
+        flat_map(const flat_map& other);
+    };
+
+    /*
+     * namespace to declare a flat_map
+     */
+    namespace declare
+    {
+
+        /**
+         * Sorted vector map with static size.
+         *
+         * \tparam  Key         Type of the keys.
+         * \tparam  T           Type of the mapped values.
+         * \tparam  N           Maximum number of elements in this map.
+         * \tparam  Compare     Function object ordering the keys.
+         */
+        template<class Key, class T, std::size_t N, class Compare = std::less<Key> >
+        class flat_map
+        :   public ::esrlabs::estd::flat_map<Key, T, Compare>
+        {
+        public:
+            typedef ::esrlabs::estd::flat_map<Key, T, Compare> base;
+            typedef ::esrlabs::estd::declare::flat_map<Key, T, N, Compare> this_type;
+
+            /**
+             * Constructs an empty map.
+             */
+            explicit flat_map(const Compare& comp = Compare());
+
+            /**
+             * Constructs a map from the elements of the range [first, last).
+             */
+            template<class InputIterator>
+            flat_map(InputIterator first, InputIterator last, const Compare& comp = Compare());
+
+            /**
+             * Constructs a map from the elements of the range [first, last),
+             * which are sorted and unique by key, without sorting them.
+             */
+            template<class InputIterator>
+            flat_map(
+                sorted_unique_t,
+                InputIterator first,
+                InputIterator last,
+                const Compare& comp = Compare());
+
+            /**
+             * Copies the elements of the other map into this map.
+             */
+            flat_map(const base& other);
+
+            /**
+             * Copies the elements of the other map into this map.
+             */
+            flat_map(const this_type& other);
+
+            /**
+             * Copies the elements of the other map into this map.
+             */
+            flat_map& operator=(const base& other);
+
+            /**
+             * Copies the elements of the other map into this map.
+             */
+            flat_map& operator=(const this_type& other);
+
+        private:
+            declare::vector<std::pair<Key, T>, N> _elements;
+        };
+
+    } /* namespace declare */
+
+/*
+ *
+ * Implementation of flat_map
+ *
+ */
+
+template<class K, class T, class C>inline
+flat_map<K, T, C>::flat_map(vector<value_type>& values, const C& comp)
+:   tree(values, comp)
+{}
+
+template<class K, class T, class C>inline
+flat_map<K, T, C>&
+flat_map<K, T, C>::operator=(const flat_map& other)
+{
+    tree::operator=(other);
+    return *this;
+}
+
+template<class K, class T, class C>inline
+typename flat_map<K, T, C>::mapped_type&
+flat_map<K, T, C>::at(const key_type& key)
+{
+    size_type const index = tree::find_index(key);
+    estd_assert(index < tree::size());
+    return tree::_values[index].second;
+}
+
+template<class K, class T, class C>inline
+const typename flat_map<K, T, C>::mapped_type&
+flat_map<K, T, C>::at(const key_type& key) const
+{
+    size_type const index = tree::find_index(key);
+    estd_assert(index < tree::size());
+    return tree::_values[index].second;
+}
+
+template<class K, class T, class C>
+typename flat_map<K, T, C>::mapped_type&
+flat_map<K, T, C>::operator[](const key_type& key)
+{
+    size_type const index = tree::lower_index(key);
+    if ((index == tree::size()) || tree::_compare(key, tree::_values[index].first))
+    {
+        estd_assert(!tree::full());
+        return tree::_values.insert(tree::begin() + index, value_type(key, mapped_type()))->second;
+    }
+    return tree::_values[index].second;
+}
+
+namespace declare
+{
+
+    template<class K, class T, std::size_t N, class C>
+    flat_map<K, T, N, C>::flat_map(const C& comp)
+    :   base(_elements, comp)
+    ,   _elements()
+    {}
+
+    template<class K, class T, std::size_t N, class C>
+    template<class InputIterator>
+    flat_map<K, T, N, C>::flat_map(InputIterator first, InputIterator last, const C& comp)
+    :   base(_elements, comp)
+    ,   _elements()
+    {
+        base::insert(first, last);
+    }
+
+    template<class K, class T, std::size_t N, class C>
+    template<class InputIterator>
+    flat_map<K, T, N, C>::flat_map(
+        sorted_unique_t,
+        InputIterator first,
+        InputIterator last,
+        const C& comp)
+    :   base(_elements, comp)
+    ,   _elements()
+    {
+        base::insert(sorted_unique, first, last);
+    }
+
+    template<class K, class T, std::size_t N, class C>
+    flat_map<K, T, N, C>::flat_map(const base& other)
+    :   base(_elements, other.key_comp())
+    ,   _elements()
+    {
+        base::operator=(other);
+    }
+
+    template<class K, class T, std::size_t N, class C>
+    flat_map<K, T, N, C>::flat_map(const this_type& other)
+    :   base(_elements, other.key_comp())
+    ,   _elements()
+    {
+        base::operator=(other);
+    }
+
+    template<class K, class T, std::size_t N, class C>
+    flat_map<K, T, N, C>&
+    flat_map<K, T, N, C>::operator=(const base& other)
+    {
+        base::operator=(other);
+        return *this;
+    }
+
+    template<class K, class T, std::size_t N, class C>
+    flat_map<K, T, N, C>&
+    flat_map<K, T, N, C>::operator=(const this_type& other)
+    {
+        base::operator=(other);
+        return *this;
+    }
+
+} /* namespace declare */
+
+} /* namespace estd */
+
+} /* namespace esrlabs */
+
+#endif
@@ -0,0 +1,351 @@
+/**
+ * Contains esrlabs::estd::flat_set and esrlabs::estd::declare::flat_set.
+ * \file
+ * \ingroup estl
+ * \copyright   E.S.R.Labs AG, 2014, All rights reserved.
+ */
+#ifndef ESTD_FLAT_SET_H
+#define ESTD_FLAT_SET_H
+
+#include <functional>
+#include <estd/flat_tree.h>
+#include <estd/vector.h>
+
+namespace esrlabs {
+namespace estd {
+
+    /**
+     * A fixed-sized set storing its keys sorted in a vector.
+     *
+     * Lookups are binary searches over contiguous memory, which makes the
+     * flat_set a good fit for tables that are filled once and read often.
+     * Inserting a single key shifts all greater keys, so ranges of keys
+     * should be inserted at once using insert(first, last), which sorts and
+     * merges them only once. Ranges which are already sorted and free of
+     * duplicates can be passed together with sorted_unique to skip sorting.
+     *
+     * Like for std::set, iterator and const_iterator both only give const
+     * access to the keys, since modifying a key breaks the order of the set.
+     *
+     * \tparam  Key         Type of the keys.
+     * \tparam  Compare     Function object ordering the keys.
+     *
+     * \section flat_set_example Usage example
+     * \code{.cpp}
+     * static const uint32_t DIAGNOSTIC_IDS[] = { 0x7DF, 0x7E0, 0x7E8 };
+     *
+     * esrlabs::estd::declare::flat_set<uint32_t, 8> diagnosticIds(
+     *     esrlabs::estd::sorted_unique, DIAGNOSTIC_IDS, DIAGNOSTIC_IDS + 3);
+     *
+     * bool isDiagnostic(uint32_t id)
+     * {
+     *     return diagnosticIds.count(id) != 0;
+     * }
+     * \endcode
+     *
+     * \see esrlabs::estd::declare::flat_set
+     */
+    template<class Key, class Compare = std::less<Key> >
+    class flat_set
+    :   public internal::flat_tree<Key, Key, internal::identity<Key>, Compare>
+    {
+        typedef internal::flat_tree<Key, Key, internal::identity<Key>, Compare> tree;
+
+    public:
+        /** The type of the keys */
+        typedef typename tree::key_type               key_type;
+        /** The type of the keys */
+        typedef typename tree::value_type             value_type;
+        /** The function object ordering the keys */
+        typedef typename tree::key_compare            key_compare;
+        /** The function object ordering the keys */
+        typedef typename tree::value_compare          value_compare;
+        /** A reference to a key */
+        typedef typename tree::reference              reference;
+        /** A const reference to a key */
+        typedef typename tree::const_reference        const_reference;
+        /** A pointer to a key */
+        typedef typename tree::pointer                pointer;
+        /** A const pointer to a key */
+        typedef typename tree::const_pointer          const_pointer;
+        /** An unsigned integral type for the size */
+        typedef typename tree::size_type              size_type;
+        /** A signed integral type */
+        typedef typename tree::difference_type        difference_type;
+        /** A const random access iterator, keys cannot be modified */
+        typedef typename tree::const_iterator         iterator;
+        /** A const random access iterator */
+        typedef typename tree::const_iterator         const_iterator;
+        /** A const random access reverse iterator, keys cannot be modified */
+        typedef typename tree::const_reverse_iterator reverse_iterator;
+        /** A const random access reverse iterator */
+        typedef typename tree::const_reverse_iterator const_reverse_iterator;
+
+        /**
+         * Copies the keys of the other set into this set.
+         */
+        flat_set& operator=(const flat_set& other);
+
+        /*
+         * The members of the tree returning mutable iterators are hidden by
+         * members returning const iterators.
+         */
+
+        /** An iterator to the smallest key. */
+        iterator begin() const { return tree::begin(); }
+        /** An iterator behind the greatest key. */
+        iterator end() const { return tree::end(); }
+        /** A reverse iterator to the greatest key. */
+        reverse_iterator rbegin() const { return tree::rbegin(); }
+        /** A reverse iterator before the smallest key. */
+        reverse_iterator rend() const { return tree::rend(); }
+
+        /**
+         * Returns an iterator to the first key not less than key.
+         *
+         * \complexity Logarithmic
+         */
+        iterator lower_bound(const key_type& key) const { return tree::lower_bound(key); }
+
+        /**
+         * Returns an iterator to the first key greater than key.
+         *
+         * \complexity Logarithmic
+         */
+        iterator upper_bound(const key_type& key) const { return tree::upper_bound(key); }
+
+        /**
+         * Returns an iterator to the given key or end().
+         *
+         * \complexity Logarithmic
+         */
+        iterator find(const key_type& key) const { return tree::find(key); }
+
+        /**
+         * Inserts key if it is not present yet.
+         *
+         * \return An iterator to key in the set and true if key has been
+         * inserted.
+         * \assert{count(key) == 1 || !full()}
+         * \complexity Linear in the number of greater keys.
+         */
+        std::pair<iterator, bool> insert(const value_type& key);
+
+        /**
+         * Inserts the keys of the range [first, last) which are not present
+         * yet, only the first of equal keys in the range is inserted. Keys
+         * that do not fit are dropped.
+         *
+         * \complexity O(n log n) in the resulting size.
+         */
+        template<class InputIterator>
+        void insert(InputIterator first, InputIterator last) { tree::insert(first, last); }
+
+        /**
+         * Like insert(first, last) for a range which is sorted and free of
+         * duplicates, which saves sorting it.
+         */
+        template<class InputIterator>
+        void insert(sorted_unique_t, InputIterator first, InputIterator last)
+        {
+            tree::insert(sorted_unique, first, last);
+        }
+
+        /**
+         * Removes the key at position.
+         *
+         * \return An iterator to the key following the removed one.
+         */
+        iterator erase(const_iterator position) { return tree::erase(position); }
+
+        /**
+         * Removes the keys in the range [first, last).
+         *
+         * \return An iterator to the key following the removed ones.
+         */
+        iterator erase(const_iterator first, const_iterator last) { return tree::erase(first, last); }
+
+        /**
+         * Removes the given key.
+         *
+         * \return The number of removed keys, 0 or 1.
+         */
+        size_type erase(const key_type& key) { return tree::erase(key); }
+
+    protected:
+        /**
+         * Constructor to initialize this set with the vector to work with.
+         * Used by the declare class.
+         */
+        flat_set(vector<Key>& values, const Compare& comp);
+
+    private:
+        flat_set(const flat_set& other);
+    };
+
+    /*
+     * namespace to declare a flat_set
+     */
+    namespace declare
+    {
+
+        /**
+         * Sorted vector set with static size.
+         *
+         * \tparam  Key         Type of the keys.
+         * \tparam  N           Maximum number of keys in this set.
+         * \tparam  Compare     Function object ordering the keys.
+         */
+        template<class Key, std::size_t N, class Compare = std::less<Key> >
+        class flat_set
+        :   public ::esrlabs::estd::flat_set<Key, Compare>
+        {
+        public:
+            typedef ::esrlabs::estd::flat_set<Key, Compare> base;
+            typedef ::esrlabs::estd::declare::flat_set<Key, N, Compare> this_type;
+
+            /**
+             * Constructs an empty set.
+             */
+            explicit flat_set(const Compare& comp = Compare());
+
+            /**
+             * Constructs a set from the keys of the range [first, last).
+             */
+            template<class InputIterator>
+            flat_set(InputIterator first, InputIterator last, const Compare& comp = Compare());
+
+            /**
+             * Constructs a set from the sorted and unique keys of the range
+             * [first, last) without sorting them.
+             */
+            template<class InputIterator>
+            flat_set(
+                sorted_unique_t,
+                InputIterator first,
+                InputIterator last,
+                const Compare& comp = Compare());
+
+            /**
+             * Copies the keys of the other set into this set.
+             */
+            flat_set(const base& other);
+
+            /**
+             * Copies the keys of the other set into this set.
+             */
+            flat_set(const this_type& other);
+
+            /**
+             * Copies the keys of the other set into this set.
+             */
+            flat_set& operator=(const base& other);
+
+            /**
+             * Copies the keys of the other set into this set.
+             */
+            flat_set& operator=(const this_type& other);
+
+        private:
+            declare::vector<Key, N> _keys;
+        };
+
+    } /* namespace declare */
+
+/*
+ *
+ * Implementation of flat_set
+ *
+ */
+
+template<class K, class C>inline
+flat_set<K, C>::flat_set(vector<K>& values, const C& comp)
+:   tree(values, comp)
+{}
+
+template<class K, class C>inline
+std::pair<typename flat_set<K, C>::iterator, bool>
+flat_set<K, C>::insert(const value_type& key)
+{
+    std::pair<typename tree::iterator, bool> const result = tree::insert(key);
+    return std::make_pair(iterator(result.first), result.second);
+}
+
+template<class K, class C>inline
+flat_set<K, C>&
+flat_set<K, C>::operator=(const flat_set& other)
+{
+    tree::operator=(other);
+    return *this;
+}
+
+namespace declare
+{
+
+    template<class K, std::size_t N, class C>
+    flat_set<K, N, C>::flat_set(const C& comp)
+    :   base(_keys, comp)
+    ,   _keys()
+    {}
+
+    template<class K, std::size_t N, class C>
+    template<class InputIterator>
+    flat_set<K, N, C>::flat_set(InputIterator first, InputIterator last, const C& comp)
+    :   base(_keys, comp)
+    ,   _keys()
+    {
+        base::insert(first, last);
+    }
+
+    template<class K, std::size_t N, class C>
+    template<class InputIterator>
+    flat_set<K, N, C>::flat_set(
+        sorted_unique_t,
+        InputIterator first,
+        InputIterator last,
+        const C& comp)
+    :   base(_keys, comp)
+    ,   _keys()
+    {
+        base::insert(sorted_unique, first, last);
+    }
+
+    template<class K, std::size_t N, class C>
+    flat_set<K, N, C>::flat_set(const base& other)
+    :   base(_keys, other.key_comp())
+    ,   _keys()
+    {
+        base::operator=(other);
+    }
+
+    template<class K, std::size_t N, class C>
+    flat_set<K, N, C>::flat_set(const this_type& other)
+    :   base(_keys, other.key_comp())
+    ,   _keys()
+    {
+        base::operator=(other);
+    }
+
+    template<class K, std::size_t N, class C>
+    flat_set<K, N, C>&
+    flat_set<K, N, C>::operator=(const base& other)
+    {
+        base::operator=(other);
+        return *this;
+    }
+
+    template<class K, std::size_t N, class C>
+    flat_set<K, N, C>&
+    flat_set<K, N, C>::operator=(const this_type& other)
+    {
+        base::operator=(other);
+        return *this;
+    }
+
+} /* namespace declare */
+
+} /* namespace estd */
+
+} /* namespace esrlabs */
+
+#endif
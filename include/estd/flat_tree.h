@@ -0,0 +1,406 @@
+/**
+ * Contains esrlabs::estd::sorted_unique and the common implementation of
+ * esrlabs::estd::flat_map and esrlabs::estd::flat_set.
+ * \file
+ * \ingroup estl
+ * \copyright   E.S.R.Labs AG, 2014, All rights reserved.
+ */
+#ifndef ESTD_FLAT_TREE_H
+#define ESTD_FLAT_TREE_H
+
+#include <algorithm>
+#include <utility>
+#include <estd/algorithm.h>
+#include <estd/assert.h>
+#include <estd/vector.h>
+
+namespace esrlabs {
+namespace estd {
+
+    /**
+     * Tag type telling that a range is sorted and free of duplicates.
+     */
+    struct sorted_unique_t
+    {
+        sorted_unique_t() {}
+    };
+
+    /**
+     * Passed to constructors and insert() of flat_map and flat_set if the
+     * given range is already sorted and free of duplicate keys, which skips
+     * sorting it.
+     */
+    static const sorted_unique_t sorted_unique;
+
+    namespace internal
+    {
+        /// \cond INTERNAL
+        template<class Pair>
+        struct select_first
+        {
+            const typename Pair::first_type& operator()(const Pair& value) const { return value.first; }
+        };
+
+        template<class ValueCompare>
+        class sorted_equivalent;
+        /// \endcond
+
+        /**
+         * A sorted vector of unique values, the common implementation of
+         * flat_map and flat_set.
+         *
+         * \tparam  Value       Type of the values.
+         * \tparam  Key         Type of the keys.
+         * \tparam  KeyOfValue  Function object returning the key of a value.
+         * \tparam  Compare     Function object ordering the keys.
+         */
+        template<class Value, class Key, class KeyOfValue, class Compare>
+        class flat_tree
+        {
+        public:
+            typedef Key                                      key_type;
+            typedef Value                                    value_type;
+            typedef Compare                                  key_compare;
+            typedef typename vector<Value>::reference        reference;
+            typedef typename vector<Value>::const_reference  const_reference;
+            typedef typename vector<Value>::pointer          pointer;
+            typedef typename vector<Value>::const_pointer    const_pointer;
+            typedef typename vector<Value>::size_type        size_type;
+            typedef typename vector<Value>::difference_type  difference_type;
+            typedef typename vector<Value>::iterator         iterator;
+            typedef typename vector<Value>::const_iterator   const_iterator;
+            typedef typename vector<Value>::reverse_iterator reverse_iterator;
+            typedef typename vector<Value>::const_reverse_iterator const_reverse_iterator;
+
+            /**
+             * Function object comparing two values by their keys.
+             */
+            class value_compare
+            {
+            public:
+                explicit value_compare(const Compare& comp) : _comp(comp) {}
+
+                bool operator()(const Value& lhs, const Value& rhs) const
+                {
+                    return _comp(KeyOfValue()(lhs), KeyOfValue()(rhs));
+                }
+
+            private:
+                Compare _comp;
+            };
+
+            /**
+             * Copies the values of the other container into this container.
+             *
+             * \assert{other.size() <= max_size()}
+             */
+            flat_tree& operator=(const flat_tree& other);
+
+            /** Returns the number of values. */
+            size_type size() const { return _values.size(); }
+            /** Returns the maximum number of values. */
+            size_type max_size() const { return _values.max_size(); }
+            /** Returns true if there are no values. */
+            bool empty() const { return _values.empty(); }
+            /** Returns true if no more values can be inserted. */
+            bool full() const { return _values.full(); }
+
+            /** An iterator to the value with the smallest key. */
+            iterator begin() { return _values.begin(); }
+            /** A const iterator to the value with the smallest key. */
+            const_iterator begin() const { return _values.begin(); }
+            /** A const iterator to the value with the smallest key. */
+            const_iterator cbegin() const { return _values.cbegin(); }
+            /** An iterator behind the value with the greatest key. */
+            iterator end() { return _values.end(); }
+            /** A const iterator behind the value with the greatest key. */
+            const_iterator end() const { return _values.end(); }
+            /** A const iterator behind the value with the greatest key. */
+            const_iterator cend() const { return _values.cend(); }
+            /** A reverse iterator to the value with the greatest key. */
+            reverse_iterator rbegin() { return _values.rbegin(); }
+            /** A const reverse iterator to the value with the greatest key. */
+            const_reverse_iterator rbegin() const { return _values.rbegin(); }
+            /** A reverse iterator before the value with the smallest key. */
+            reverse_iterator rend() { return _values.rend(); }
+            /** A const reverse iterator before the value with the smallest key. */
+            const_reverse_iterator rend() const { return _values.rend(); }
+
+            /** Returns the function object ordering the keys. */
+            key_compare key_comp() const { return _compare; }
+            /** Returns the function object ordering the values. */
+            value_compare value_comp() const { return value_compare(_compare); }
+
+            /**
+             * Returns an iterator to the first value with a key not less
+             * than key.
+             *
+             * \complexity Logarithmic
+             */
+            iterator lower_bound(const key_type& key) { return begin() + lower_index(key); }
+            /** \copydoc lower_bound() */
+            const_iterator lower_bound(const key_type& key) const { return begin() + lower_index(key); }
+
+            /**
+             * Returns an iterator to the first value with a key greater
+             * than key.
+             *
+             * \complexity Logarithmic
+             */
+            iterator upper_bound(const key_type& key) { return begin() + upper_index(key); }
+            /** \copydoc upper_bound() */
+            const_iterator upper_bound(const key_type& key) const { return begin() + upper_index(key); }
+
+            /**
+             * Returns an iterator to the value with the given key or end().
+             *
+             * \complexity Logarithmic
+             */
+            iterator find(const key_type& key) { return begin() + find_index(key); }
+            /** \copydoc find() */
+            const_iterator find(const key_type& key) const { return begin() + find_index(key); }
+
+            /**
+             * Returns the number of values with the given key, 0 or 1.
+             *
+             * \complexity Logarithmic
+             */
+            size_type count(const key_type& key) const { return (find_index(key) == size()) ? 0 : 1; }
+
+            /**
+             * Inserts value if its key is not present yet.
+             *
+             * \return An iterator to the value with the key of value and true
+             * if value has been inserted.
+             * \assert{count(key of value) == 1 || !full()}
+             * \complexity Linear in the number of values with greater keys.
+             */
+            std::pair<iterator, bool> insert(const value_type& value);
+
+            /**
+             * Inserts the values of the range [first, last) whose keys are not
+             * present yet. The values are appended, sorted and merged with the
+             * existing values at once. Values that do not fit are dropped.
+             * Like repeated single inserts, only the first of several values
+             * with the same key in the range is inserted.
+             *
+             * \complexity O(n log n) in the resulting size.
+             */
+            template<class InputIterator>
+            void insert(InputIterator first, InputIterator last);
+
+            /**
+             * Like insert(first, last) for a range which is sorted and free of
+             * duplicate keys, which saves sorting it.
+             */
+            template<class InputIterator>
+            void insert(sorted_unique_t, InputIterator first, InputIterator last);
+
+            /**
+             * Removes the value at position.
+             *
+             * \return An iterator to the value following the removed one.
+             */
+            iterator erase(const_iterator position) { return _values.erase(position); }
+
+            /**
+             * Removes the values in the range [first, last).
+             *
+             * \return An iterator to the value following the removed ones.
+             */
+            iterator erase(const_iterator first, const_iterator last) { return _values.erase(first, last); }
+
+            /**
+             * Removes the value with the given key.
+             *
+             * \return The number of removed values, 0 or 1.
+             */
+            size_type erase(const key_type& key);
+
+            /** Removes all values. */
+            void clear() { _values.clear(); }
+
+        protected:
+            flat_tree(vector<Value>& values, const Compare& comp)
+            :   _values(values)
+            ,   _compare(comp)
+            {}
+
+            size_type lower_index(const key_type& key) const;
+            size_type upper_index(const key_type& key) const;
+            size_type find_index(const key_type& key) const;
+
+            vector<Value>& _values;
+            Compare _compare;
+
+        private:
+            flat_tree(const flat_tree& other);
+
+            template<class InputIterator>
+            void bulk_insert(InputIterator first, InputIterator last, bool sorted);
+        };
+
+        /// \cond INTERNAL
+        /*
+         * Equivalence of neighbours in a sorted range.
+         */
+        template<class ValueCompare>
+        class sorted_equivalent
+        {
+        public:
+            explicit sorted_equivalent(const ValueCompare& comp) : _comp(comp) {}
+
+            template<class Value>
+            bool operator()(const Value& lhs, const Value& rhs) const { return !_comp(lhs, rhs); }
+
+        private:
+            ValueCompare _comp;
+        };
+
+        template<class V, class K, class KoV, class C>
+        flat_tree<V, K, KoV, C>&
+        flat_tree<V, K, KoV, C>::operator=(const flat_tree& other)
+        {
+            _values = other._values;
+            _compare = other._compare;
+            return *this;
+        }
+
+        /*
+         * The binary searches halve the range without branching on the
+         * comparison, which compiles to conditional moves and avoids
+         * mispredicted branches.
+         */
+        template<class V, class K, class KoV, class C>
+        typename flat_tree<V, K, KoV, C>::size_type
+        flat_tree<V, K, KoV, C>::lower_index(const key_type& key) const
+        {
+            size_type n = size();
+            if (n == 0)
+            {
+                return 0;
+            }
+            size_type first = 0;
+            while (n > 1)
+            {
+                size_type const half = n / 2;
+                first = _compare(KoV()(_values[first + half - 1]), key) ? (first + half) : first;
+                n -= half;
+            }
+            return first + (_compare(KoV()(_values[first]), key) ? 1 : 0);
+        }
+
+        template<class V, class K, class KoV, class C>
+        typename flat_tree<V, K, KoV, C>::size_type
+        flat_tree<V, K, KoV, C>::upper_index(const key_type& key) const
+        {
+            size_type n = size();
+            if (n == 0)
+            {
+                return 0;
+            }
+            size_type first = 0;
+            while (n > 1)
+            {
+                size_type const half = n / 2;
+                first = _compare(key, KoV()(_values[first + half - 1])) ? first : (first + half);
+                n -= half;
+            }
+            return first + (_compare(key, KoV()(_values[first])) ? 0 : 1);
+        }
+
+        template<class V, class K, class KoV, class C>inline
+        typename flat_tree<V, K, KoV, C>::size_type
+        flat_tree<V, K, KoV, C>::find_index(const key_type& key) const
+        {
+            size_type const index = lower_index(key);
+            return ((index == size()) || _compare(key, KoV()(_values[index]))) ? size() : index;
+        }
+
+        template<class V, class K, class KoV, class C>
+        std::pair<typename flat_tree<V, K, KoV, C>::iterator, bool>
+        flat_tree<V, K, KoV, C>::insert(const value_type& value)
+        {
+            size_type const index = lower_index(KoV()(value));
+            if ((index < size()) && !_compare(KoV()(value), KoV()(_values[index])))
+            {
+                return std::make_pair(begin() + index, false);
+            }
+            estd_assert(!full());
+            return std::make_pair(_values.insert(begin() + index, value), true);
+        }
+
+        template<class V, class K, class KoV, class C>
+        template<class InputIterator>
+        void
+        flat_tree<V, K, KoV, C>::insert(InputIterator first, InputIterator last)
+        {
+            bulk_insert(first, last, false);
+        }
+
+        template<class V, class K, class KoV, class C>
+        template<class InputIterator>
+        void
+        flat_tree<V, K, KoV, C>::insert(sorted_unique_t, InputIterator first, InputIterator last)
+        {
+            bulk_insert(first, last, true);
+        }
+
+        /*
+         * Appends as many values as fit, sorts them and merges them with
+         * the existing ones. Values with keys already present are dropped
+         * and the remaining values are processed the same way. Sorting and
+         * merging are stable, so the first value of a key survives.
+         */
+        template<class V, class K, class KoV, class C>
+        template<class InputIterator>
+        void
+        flat_tree<V, K, KoV, C>::bulk_insert(InputIterator first, InputIterator last, bool sorted)
+        {
+            while ((first != last) && !full())
+            {
+                size_type const existing = size();
+                for (; (first != last) && !full(); ++first)
+                {
+                    _values.push_back(*first);
+                }
+                iterator const middle = begin() + existing;
+                if (!sorted)
+                {
+                    ::esrlabs::estd::stable_sort(middle, end(), value_comp());
+                }
+                else if (existing == 0)
+                {
+                    // nothing to merge with and free of duplicates
+                    continue;
+                }
+                if ((existing > 0) && value_comp()(*middle, *(middle - 1)))
+                {
+                    ::esrlabs::estd::inplace_merge(begin(), middle, end(), value_comp());
+                }
+                // unique keeps the first of equivalent values
+                (void)_values.erase(
+                    std::unique(begin(), end(), sorted_equivalent<value_compare>(value_comp())),
+                    end());
+            }
+        }
+
+        template<class V, class K, class KoV, class C>
+        typename flat_tree<V, K, KoV, C>::size_type
+        flat_tree<V, K, KoV, C>::erase(const key_type& key)
+        {
+            size_type const index = find_index(key);
+            if (index == size())
+            {
+                return 0;
+            }
+            (void)_values.erase(begin() + index);
+            return 1;
+        }
+        /// \endcond
+    } /* namespace internal */
+
+} /* namespace estd */
+} /* namespace esrlabs */
+
+#endif /* ESTD_FLAT_TREE_H */
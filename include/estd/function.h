@@ -0,0 +1,789 @@
+/**
+ * Contains esrlabs::estd::function and esrlabs::estd::declare::function.
+ * \file
+ * \ingroup estl
+ * \copyright   E.S.R.Labs AG, 2014, All rights reserved.
+ */
+#ifndef ESTD_FUNCTION_H
+#define ESTD_FUNCTION_H
+
+#include <new>
+#include <estd/assert.h>
+#include <estd/estdint.h>
+#include <estd/type_traits.h>
+
+namespace esrlabs {
+namespace estd {
+
+    namespace internal
+    {
+        /// \cond INTERNAL
+        /*
+         * The part of a function that does not depend on the signature: the
+         * storage of the callable and the functions to copy and destroy it.
+         * Trivially copyable callables, e.g. function pointers and functors
+         * capturing pointers and numbers only, have no manager and are
+         * copied with memcpy.
+         */
+        class function_base
+        {
+        public:
+            typedef std::size_t size_type;
+
+            size_type capacity() const { return _capacity; }
+
+            bool empty() const { return _invoker == 0L; }
+
+            void clear()
+            {
+                if (_manager != 0L)
+                {
+                    _manager(0L, _storage);
+                }
+                _size = 0;
+                _invoker = 0L;
+                _manager = 0L;
+            }
+
+        protected:
+            typedef void (*invoker_type)();
+
+            // copies the callable at src to dst, or destroys the callable
+            // at src if dst is 0L
+            typedef void (*manager_type)(uint8_t* dst, uint8_t* src);
+
+            function_base(uint8_t storage[], size_type capacity)
+            :   _storage(storage)
+            ,   _capacity(capacity)
+            ,   _size(0)
+            ,   _invoker(0L)
+            ,   _manager(0L)
+            {}
+
+            ~function_base() {}
+
+            void copy(const function_base& other);
+
+            template<class F>
+            void store(const F& f, invoker_type invoker);
+
+            uint8_t* _storage;
+            size_type _capacity;
+            // size of the callable
+            size_type _size;
+            invoker_type _invoker;
+            manager_type _manager;
+
+        private:
+            template<class F>
+            static void manage(uint8_t* dst, uint8_t* src);
+
+            function_base(const function_base& other);
+            function_base& operator=(const function_base& other);
+        };
+
+        template<class F, std::size_t Bytes>
+        struct function_fits
+        {
+            typedef char callable_does_not_fit_into_the_storage[
+                (sizeof(F) <= Bytes) ? 1 : -1];
+            typedef char callable_needs_a_stricter_alignment_than_the_storage[
+                (alignment_of<F>::value <= alignment_of<_max_align>::value) ? 1 : -1];
+        };
+        /// \endcond
+    } /* namespace internal */
+
+    /**
+     * A callable object with the signature Signature, like std::function,
+     * that keeps the callable it has been assigned, e.g. a function pointer
+     * or a functor with its captured state, in storage of a fixed size
+     * instead of allocating it.
+     *
+     * Signatures with up to five arguments are supported. Use an
+     * esrlabs::estd::declare::function to provide the storage, its size is
+     * checked at compile time when a callable is assigned. Functions can be
+     * passed around and assigned to each other as references to
+     * esrlabs::estd::function, which only checks at runtime that the
+     * callable of the other function fits. A function is empty() until a
+     * callable is assigned and after clear(), capacity() is the size of
+     * its storage in bytes.
+     *
+     * Calling a function takes an indirect call, as calling a virtual
+     * function does. Callables that are trivially copyable are copied with
+     * memcpy and not destroyed, other callables are copied and destroyed
+     * with their copy constructor and destructor.
+     *
+     * \tparam  Signature   The function type of the callable, e.g.
+     *                      void(uint8_t const*, std::size_t).
+     *
+     * \section function_example Usage example
+     * \code{.cpp}
+     * struct Forward
+     * {
+     *     Channel* channel;
+     *     void operator()(uint8_t const* data, std::size_t size) const
+     *     {
+     *         channel->send(data, size);
+     *     }
+     * };
+     *
+     * esrlabs::estd::declare::function<void(uint8_t const*, std::size_t), 8> handlers[MAX_ID];
+     *
+     * void subscribe(uint32_t id, Channel& channel)
+     * {
+     *     Forward const forward = { &channel };
+     *     handlers[id] = forward;
+     * }
+     *
+     * void dispatch(uint32_t id, uint8_t const* data, std::size_t size)
+     * {
+     *     if (!handlers[id].empty())
+     *     {
+     *         handlers[id](data, size);
+     *     }
+     * }
+     * \endcode
+     *
+     * \see esrlabs::estd::declare::function
+     */
+    template<class Signature>
+    class function;
+
+    /**
+     * A function without arguments, see esrlabs::estd::function.
+     */
+    template<class R>
+    class function<R()>
+    :   public internal::function_base
+    {
+    public:
+        /** The type of the result */
+        typedef R result_type;
+
+        /**
+         * Copies the callable of other into this function.
+         *
+         * \assert{the callable of other fits into capacity()}
+         */
+        function& operator=(const function& other);
+
+        /**
+         * Calls the callable.
+         *
+         * \assert{!empty()}
+         */
+        R operator()() const;
+
+    protected:
+        function(uint8_t storage[], size_type capacity)
+        :   function_base(storage, capacity)
+        {}
+
+        template<class F>
+        void assign(const F& f);
+
+    private:
+        typedef R (*invoker)(uint8_t*);
+
+        template<class F>
+        static R invoke(uint8_t* callable);
+
+        function(const function& other);
+    };
+
+    /**
+     * A function with one argument, see esrlabs::estd::function.
+     */
+    template<class R, class A1>
+    class function<R(A1)>
+    :   public internal::function_base
+    {
+    public:
+        /** The type of the result */
+        typedef R result_type;
+        /** The type of the argument */
+        typedef A1 argument_type;
+
+        /**
+         * Copies the callable of other into this function.
+         *
+         * \assert{the callable of other fits into capacity()}
+         */
+        function& operator=(const function& other);
+
+        /**
+         * Calls the callable.
+         *
+         * \assert{!empty()}
+         */
+        R operator()(A1 a1) const;
+
+    protected:
+        function(uint8_t storage[], size_type capacity)
+        :   function_base(storage, capacity)
+        {}
+
+        template<class F>
+        void assign(const F& f);
+
+    private:
+        typedef R (*invoker)(uint8_t*, A1);
+
+        template<class F>
+        static R invoke(uint8_t* callable, A1 a1);
+
+        function(const function& other);
+    };
+
+    /**
+     * A function with two arguments, see esrlabs::estd::function.
+     */
+    template<class R, class A1, class A2>
+    class function<R(A1, A2)>
+    :   public internal::function_base
+    {
+    public:
+        /** The type of the result */
+        typedef R result_type;
+        /** The type of the first argument */
+        typedef A1 first_argument_type;
+        /** The type of the second argument */
+        typedef A2 second_argument_type;
+
+        /**
+         * Copies the callable of other into this function.
+         *
+         * \assert{the callable of other fits into capacity()}
+         */
+        function& operator=(const function& other);
+
+        /**
+         * Calls the callable.
+         *
+         * \assert{!empty()}
+         */
+        R operator()(A1 a1, A2 a2) const;
+
+    protected:
+        function(uint8_t storage[], size_type capacity)
+        :   function_base(storage, capacity)
+        {}
+
+        template<class F>
+        void assign(const F& f);
+
+    private:
+        typedef R (*invoker)(uint8_t*, A1, A2);
+
+        template<class F>
+        static R invoke(uint8_t* callable, A1 a1, A2 a2);
+
+        function(const function& other);
+    };
+
+    /**
+     * A function with three arguments, see esrlabs::estd::function.
+     */
+    template<class R, class A1, class A2, class A3>
+    class function<R(A1, A2, A3)>
+    :   public internal::function_base
+    {
+    public:
+        /** The type of the result */
+        typedef R result_type;
+
+        /**
+         * Copies the callable of other into this function.
+         *
+         * \assert{the callable of other fits into capacity()}
+         */
+        function& operator=(const function& other);
+
+        /**
+         * Calls the callable.
+         *
+         * \assert{!empty()}
+         */
+        R operator()(A1 a1, A2 a2, A3 a3) const;
+
+    protected:
+        function(uint8_t storage[], size_type capacity)
+        :   function_base(storage, capacity)
+        {}
+
+        template<class F>
+        void assign(const F& f);
+
+    private:
+        typedef R (*invoker)(uint8_t*, A1, A2, A3);
+
+        template<class F>
+        static R invoke(uint8_t* callable, A1 a1, A2 a2, A3 a3);
+
+        function(const function& other);
+    };
+
+    /**
+     * A function with four arguments, see esrlabs::estd::function.
+     */
+    template<class R, class A1, class A2, class A3, class A4>
+    class function<R(A1, A2, A3, A4)>
+    :   public internal::function_base
+    {
+    public:
+        /** The type of the result */
+        typedef R result_type;
+
+        /**
+         * Copies the callable of other into this function.
+         *
+         * \assert{the callable of other fits into capacity()}
+         */
+        function& operator=(const function& other);
+
+        /**
+         * Calls the callable.
+         *
+         * \assert{!empty()}
+         */
+        R operator()(A1 a1, A2 a2, A3 a3, A4 a4) const;
+
+    protected:
+        function(uint8_t storage[], size_type capacity)
+        :   function_base(storage, capacity)
+        {}
+
+        template<class F>
+        void assign(const F& f);
+
+    private:
+        typedef R (*invoker)(uint8_t*, A1, A2, A3, A4);
+
+        template<class F>
+        static R invoke(uint8_t* callable, A1 a1, A2 a2, A3 a3, A4 a4);
+
+        function(const function& other);
+    };
+
+    /**
+     * A function with five arguments, see esrlabs::estd::function.
+     */
+    template<class R, class A1, class A2, class A3, class A4, class A5>
+    class function<R(A1, A2, A3, A4, A5)>
+    :   public internal::function_base
+    {
+    public:
+        /** The type of the result */
+        typedef R result_type;
+
+        /**
+         * Copies the callable of other into this function.
+         *
+         * \assert{the callable of other fits into capacity()}
+         */
+        function& operator=(const function& other);
+
+        /**
+         * Calls the callable.
+         *
+         * \assert{!empty()}
+         */
+        R operator()(A1 a1, A2 a2, A3 a3, A4 a4, A5 a5) const;
+
+    protected:
+        function(uint8_t storage[], size_type capacity)
+        :   function_base(storage, capacity)
+        {}
+
+        template<class F>
+        void assign(const F& f);
+
+    private:
+        typedef R (*invoker)(uint8_t*, A1, A2, A3, A4, A5);
+
+        template<class F>
+        static R invoke(uint8_t* callable, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5);
+
+        function(const function& other);
+    };
+
+    /*
+     * namespace to declare a function
+     */
+    namespace declare
+    {
+
+        /**
+         * Function with storage of a static size.
+         *
+         * \tparam  Signature   The function type of the callable.
+         * \tparam  Bytes       The size of the storage of the callable,
+         *                      defaults to the size of two pointers.
+         */
+        template<class Signature, std::size_t Bytes = 2 * sizeof(void*)>
+        class function
+        :   public ::esrlabs::estd::function<Signature>
+        {
+        public:
+            typedef ::esrlabs::estd::function<Signature> base;
+            typedef ::esrlabs::estd::declare::function<Signature, Bytes> this_type;
+
+            /**
+             * Constructs an empty function.
+             */
+            function();
+
+            /**
+             * Constructs a function calling a copy of f.
+             *
+             * Fails to compile if f does not fit into Bytes.
+             */
+            template<class F>
+            function(F f, typename enable_if<!is_base_of<base, F>::value, int>::type = 0);
+
+            /**
+             * Copies the callable of other.
+             *
+             * \assert{the callable of other fits into Bytes}
+             */
+            function(const base& other);
+
+            /**
+             * Copies the callable of other.
+             */
+            function(const this_type& other);
+
+            /**
+             * Destroys the callable.
+             */
+            ~function();
+
+            /**
+             * Replaces the callable by a copy of f.
+             *
+             * Fails to compile if f does not fit into Bytes.
+             */
+            template<class F>
+            typename enable_if<!is_base_of<base, F>::value, function&>::type
+            operator=(F f);
+
+            /**
+             * Copies the callable of other.
+             *
+             * \assert{the callable of other fits into Bytes}
+             */
+            function& operator=(const base& other);
+
+            /**
+             * Copies the callable of other.
+             */
+            function& operator=(const this_type& other);
+
+        private:
+            typename aligned_storage<Bytes>::type _storage;
+        };
+
+    } /* namespace declare */
+
+/*
+ *
+ * Implementation of function
+ *
+ */
+
+namespace internal
+{
+/// \cond INTERNAL
+
+template<class F>
+void
+function_base::store(const F& f, invoker_type invoker)
+{
+    clear();
+    estd_assert(sizeof(F) <= _capacity);
+    (void)new(_storage) F(f);
+    _size = sizeof(F);
+    _invoker = invoker;
+    _manager = is_trivially_copyable<F>::value ? 0L : &function_base::manage<F>;
+}
+
+template<class F>
+void
+function_base::manage(uint8_t* dst, uint8_t* src)
+{
+    F* const callable = reinterpret_cast<F*>(src);
+    if (dst != 0L)
+    {
+        (void)new(dst) F(*callable);
+    }
+    else
+    {
+        callable->~F();
+    }
+}
+
+/// \endcond
+} /* namespace internal */
+
+template<class R>inline
+function<R()>&
+function<R()>::operator=(const function& other)
+{
+    copy(other);
+    return *this;
+}
+
+template<class R>inline
+R
+function<R()>::operator()() const
+{
+    estd_assert(!empty());
+    return reinterpret_cast<invoker>(_invoker)(_storage);
+}
+
+template<class R>
+template<class F>inline
+void
+function<R()>::assign(const F& f)
+{
+    store(f, reinterpret_cast<invoker_type>(&function::template invoke<F>));
+}
+
+template<class R>
+template<class F>
+R
+function<R()>::invoke(uint8_t* callable)
+{
+    return (*reinterpret_cast<F*>(callable))();
+}
+
+template<class R, class A1>inline
+function<R(A1)>&
+function<R(A1)>::operator=(const function& other)
+{
+    copy(other);
+    return *this;
+}
+
+template<class R, class A1>inline
+R
+function<R(A1)>::operator()(A1 a1) const
+{
+    estd_assert(!empty());
+    return reinterpret_cast<invoker>(_invoker)(_storage, a1);
+}
+
+template<class R, class A1>
+template<class F>inline
+void
+function<R(A1)>::assign(const F& f)
+{
+    store(f, reinterpret_cast<invoker_type>(&function::template invoke<F>));
+}
+
+template<class R, class A1>
+template<class F>
+R
+function<R(A1)>::invoke(uint8_t* callable, A1 a1)
+{
+    return (*reinterpret_cast<F*>(callable))(a1);
+}
+
+template<class R, class A1, class A2>inline
+function<R(A1, A2)>&
+function<R(A1, A2)>::operator=(const function& other)
+{
+    copy(other);
+    return *this;
+}
+
+template<class R, class A1, class A2>inline
+R
+function<R(A1, A2)>::operator()(A1 a1, A2 a2) const
+{
+    estd_assert(!empty());
+    return reinterpret_cast<invoker>(_invoker)(_storage, a1, a2);
+}
+
+template<class R, class A1, class A2>
+template<class F>inline
+void
+function<R(A1, A2)>::assign(const F& f)
+{
+    store(f, reinterpret_cast<invoker_type>(&function::template invoke<F>));
+}
+
+template<class R, class A1, class A2>
+template<class F>
+R
+function<R(A1, A2)>::invoke(uint8_t* callable, A1 a1, A2 a2)
+{
+    return (*reinterpret_cast<F*>(callable))(a1, a2);
+}
+
+template<class R, class A1, class A2, class A3>inline
+function<R(A1, A2, A3)>&
+function<R(A1, A2, A3)>::operator=(const function& other)
+{
+    copy(other);
+    return *this;
+}
+
+template<class R, class A1, class A2, class A3>inline
+R
+function<R(A1, A2, A3)>::operator()(A1 a1, A2 a2, A3 a3) const
+{
+    estd_assert(!empty());
+    return reinterpret_cast<invoker>(_invoker)(_storage, a1, a2, a3);
+}
+
+template<class R, class A1, class A2, class A3>
+template<class F>inline
+void
+function<R(A1, A2, A3)>::assign(const F& f)
+{
+    store(f, reinterpret_cast<invoker_type>(&function::template invoke<F>));
+}
+
+template<class R, class A1, class A2, class A3>
+template<class F>
+R
+function<R(A1, A2, A3)>::invoke(uint8_t* callable, A1 a1, A2 a2, A3 a3)
+{
+    return (*reinterpret_cast<F*>(callable))(a1, a2, a3);
+}
+
+template<class R, class A1, class A2, class A3, class A4>inline
+function<R(A1, A2, A3, A4)>&
+function<R(A1, A2, A3, A4)>::operator=(const function& other)
+{
+    copy(other);
+    return *this;
+}
+
+template<class R, class A1, class A2, class A3, class A4>inline
+R
+function<R(A1, A2, A3, A4)>::operator()(A1 a1, A2 a2, A3 a3, A4 a4) const
+{
+    estd_assert(!empty());
+    return reinterpret_cast<invoker>(_invoker)(_storage, a1, a2, a3, a4);
+}
+
+template<class R, class A1, class A2, class A3, class A4>
+template<class F>inline
+void
+function<R(A1, A2, A3, A4)>::assign(const F& f)
+{
+    store(f, reinterpret_cast<invoker_type>(&function::template invoke<F>));
+}
+
+template<class R, class A1, class A2, class A3, class A4>
+template<class F>
+R
+function<R(A1, A2, A3, A4)>::invoke(uint8_t* callable, A1 a1, A2 a2, A3 a3, A4 a4)
+{
+    return (*reinterpret_cast<F*>(callable))(a1, a2, a3, a4);
+}
+
+template<class R, class A1, class A2, class A3, class A4, class A5>inline
+function<R(A1, A2, A3, A4, A5)>&
+function<R(A1, A2, A3, A4, A5)>::operator=(const function& other)
+{
+    copy(other);
+    return *this;
+}
+
+template<class R, class A1, class A2, class A3, class A4, class A5>inline
+R
+function<R(A1, A2, A3, A4, A5)>::operator()(A1 a1, A2 a2, A3 a3, A4 a4, A5 a5) const
+{
+    estd_assert(!empty());
+    return reinterpret_cast<invoker>(_invoker)(_storage, a1, a2, a3, a4, a5);
+}
+
+template<class R, class A1, class A2, class A3, class A4, class A5>
+template<class F>inline
+void
+function<R(A1, A2, A3, A4, A5)>::assign(const F& f)
+{
+    store(f, reinterpret_cast<invoker_type>(&function::template invoke<F>));
+}
+
+template<class R, class A1, class A2, class A3, class A4, class A5>
+template<class F>
+R
+function<R(A1, A2, A3, A4, A5)>::invoke(uint8_t* callable, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5)
+{
+    return (*reinterpret_cast<F*>(callable))(a1, a2, a3, a4, a5);
+}
+
+namespace declare
+{
+
+    template<class S, std::size_t B>
+    function<S, B>::function()
+    :   base(_storage.data, B)
+    {}
+
+    template<class S, std::size_t B>
+    template<class F>
+    function<S, B>::function(F f, typename enable_if<!is_base_of<base, F>::value, int>::type)
+    :   base(_storage.data, B)
+    {
+        (void)sizeof(internal::function_fits<F, B>);
+        base::assign(f);
+    }
+
+    template<class S, std::size_t B>
+    function<S, B>::function(const base& other)
+    :   base(_storage.data, B)
+    {
+        base::operator=(other);
+    }
+
+    template<class S, std::size_t B>
+    function<S, B>::function(const this_type& other)
+    :   base(_storage.data, B)
+    {
+        base::operator=(other);
+    }
+
+    template<class S, std::size_t B>
+    function<S, B>::~function()
+    {
+        base::clear();
+    }
+
+    template<class S, std::size_t B>
+    template<class F>
+    typename enable_if<!is_base_of<typename function<S, B>::base, F>::value, function<S, B>&>::type
+    function<S, B>::operator=(F f)
+    {
+        (void)sizeof(internal::function_fits<F, B>);
+        base::assign(f);
+        return *this;
+    }
+
+    template<class S, std::size_t B>
+    function<S, B>&
+    function<S, B>::operator=(const base& other)
+    {
+        base::operator=(other);
+        return *this;
+    }
+
+    template<class S, std::size_t B>
+    function<S, B>&
+    function<S, B>::operator=(const this_type& other)
+    {
+        base::operator=(other);
+        return *this;
+    }
+
+} /* namespace declare */
+
+} /* namespace estd */
+
+} /* namespace esrlabs */
+
+#endif /* ESTD_FUNCTION_H */
@@ -0,0 +1,106 @@
+/**
+ * Contains esrlabs::estd::hash.
+ * \file
+ * \ingroup estl
+ * \copyright   E.S.R.Labs AG, 2014, All rights reserved.
+ */
+#ifndef ESTD_HASH_H
+#define ESTD_HASH_H
+
+#include <cstddef>
+#include <estd/estdint.h>
+#include <estd/type_traits.h>
+
+namespace esrlabs {
+namespace estd {
+
+    /**
+     * Function object calculating the hash of a key. The hash does not need
+     * to be well distributed, the hash containers mix the bits of the hash
+     * before using it. Specialize this template to use other key types.
+     *
+     * \tparam  T   The type of the key.
+     */
+    template<class T>
+    struct hash;
+
+    /**
+     * Hash of a pointer, the address itself.
+     */
+    template<class T>
+    struct hash<T*>
+    {
+        std::size_t operator()(T* value) const
+        {
+            return reinterpret_cast<std::size_t>(value);
+        }
+    };
+
+/// \cond INTERNAL
+#define ESTD_INTEGRAL_HASH(T) \
+    template<> \
+    struct hash<T> \
+    { \
+        std::size_t operator()(T value) const \
+        { \
+            return static_cast<std::size_t>(value); \
+        } \
+    }
+
+    ESTD_INTEGRAL_HASH(bool);
+    ESTD_INTEGRAL_HASH(char);
+    ESTD_INTEGRAL_HASH(signed char);
+    ESTD_INTEGRAL_HASH(unsigned char);
+    ESTD_INTEGRAL_HASH(short);
+    ESTD_INTEGRAL_HASH(unsigned short);
+    ESTD_INTEGRAL_HASH(int);
+    ESTD_INTEGRAL_HASH(unsigned int);
+    ESTD_INTEGRAL_HASH(long);
+    ESTD_INTEGRAL_HASH(unsigned long);
+
+#undef ESTD_INTEGRAL_HASH
+
+#if defined(HAS_STDINT_H_) || defined(HAS_CSTDINT_H_)
+    namespace internal
+    {
+        /*
+         * int64_t and uint64_t are long long on 32 bit targets. Where they
+         * are long, which has a hash already, this unused type takes their
+         * place.
+         */
+        template<class T, class Long>
+        struct wide_integral
+        {
+            typedef typename conditional<is_same<T, Long>::value, wide_integral, T>::type type;
+        };
+
+        template<class T>
+        struct wide_integral_hash
+        {
+            std::size_t operator()(T value) const
+            {
+                // folds the high word into a 32 bit size_t
+                return static_cast<std::size_t>(value ^ (value >> 32));
+            }
+        };
+
+        typedef wide_integral<int64_t, long>::type int64_key;
+        typedef wide_integral<uint64_t, unsigned long>::type uint64_key;
+    } /* namespace internal */
+
+    template<>
+    struct hash<internal::int64_key>
+    :   public internal::wide_integral_hash<internal::int64_key>
+    {};
+
+    template<>
+    struct hash<internal::uint64_key>
+    :   public internal::wide_integral_hash<internal::uint64_key>
+    {};
+#endif
+/// \endcond
+
+} /* namespace estd */
+} /* namespace esrlabs */
+
+#endif /* ESTD_HASH_H */
@@ -0,0 +1,712 @@
+/**
+ * Contains esrlabs::estd::intrusive_list and its hooks.
+ * \file
+ * \ingroup estl
+ * \copyright   E.S.R.Labs AG, 2014, All rights reserved.
+ */
+#ifndef ESTD_INTRUSIVE_LIST_H
+#define ESTD_INTRUSIVE_LIST_H
+
+#include <cstddef>
+#include <iterator>
+#include <estd/assert.h>
+#include <estd/type_traits.h>
+#include <estd/uncopyable.h>
+
+namespace esrlabs {
+namespace estd {
+
+    namespace internal
+    {
+        /// \cond INTERNAL
+        /*
+         * The links of a value in a list. A node that is not in a list has
+         * null links. Copying a value does not copy its membership.
+         */
+        class intrusive_list_node
+        {
+        public:
+            intrusive_list_node() : _prev(0), _next(0) {}
+
+            intrusive_list_node(const intrusive_list_node&) : _prev(0), _next(0) {}
+
+            intrusive_list_node& operator=(const intrusive_list_node&) { return *this; }
+
+#ifndef ESTL_NO_ASSERT
+            // a value must be removed from its list before it is destroyed
+            ~intrusive_list_node() { estd_assert(_next == 0); }
+#endif
+
+            bool is_linked() const { return _next != 0; }
+
+            intrusive_list_node* _prev;
+            intrusive_list_node* _next;
+        };
+
+        template<class T, class Hook, class Value>
+        class intrusive_list_iterator;
+        /// \endcond
+    } /* namespace internal */
+
+    /**
+     * The links that put a value into an intrusive_list. A value has a
+     * hook for each list it can be in at the same time, either as base
+     * class or as member.
+     *
+     * Types with a hook must not specialize is_trivially_relocatable to
+     * true_type, as the neighbours of a linked value point to its address.
+     *
+     * \tparam  Tag Distinguishes several base class hooks of a type.
+     *
+     * \see esrlabs::estd::intrusive_list
+     */
+    template<class Tag = void>
+    class intrusive_list_hook
+    :   public internal::intrusive_list_node
+    {
+    public:
+        /**
+         * Returns true if the value is in a list.
+         */
+        bool is_linked() const { return internal::intrusive_list_node::is_linked(); }
+    };
+
+    /**
+     * Hook policy for values of type T that derive from
+     * intrusive_list_hook<Tag>.
+     */
+    template<class T, class Tag = void>
+    struct intrusive_list_base_hook
+    {
+        /// \cond INTERNAL
+        typedef intrusive_list_hook<Tag> hook_type;
+
+        static internal::intrusive_list_node* to_node(T& value)
+        {
+            return &static_cast<hook_type&>(value);
+        }
+
+        static T& to_value(internal::intrusive_list_node* node)
+        {
+            return static_cast<T&>(*static_cast<hook_type*>(node));
+        }
+        /// \endcond
+    };
+
+    /**
+     * Hook policy for values of type T that have the intrusive_list_hook
+     * Member.
+     */
+    template<class T, intrusive_list_hook<> T::*Member>
+    struct intrusive_list_member_hook
+    {
+        /// \cond INTERNAL
+        typedef intrusive_list_hook<> hook_type;
+
+        static internal::intrusive_list_node* to_node(T& value)
+        {
+            return &(value.*Member);
+        }
+
+        static T& to_value(internal::intrusive_list_node* node)
+        {
+            return *reinterpret_cast<T*>(reinterpret_cast<char*>(node) - offset());
+        }
+
+        /*
+         * The offset of the member, taken from uninitialized storage that
+         * is never accessed. The compiler folds it to a constant.
+         */
+        static std::ptrdiff_t offset()
+        {
+            static typename aligned_storage<sizeof(T), alignment_of<T>::value>::type storage;
+            T* const value = reinterpret_cast<T*>(&storage);
+            return reinterpret_cast<char*>(&(value->*Member)) - reinterpret_cast<char*>(value);
+        }
+        /// \endcond
+    };
+
+    /**
+     * A doubly linked list of values that carry their own links, so
+     * inserting and removing never allocates and never moves the values.
+     * The values stay where they are, e.g. in an object_pool or a static
+     * array, and can be in several lists at once with one hook for each.
+     *
+     * A linked value must not be moved by the container holding it. This
+     * rules out inserting into or erasing from the middle of a vector or
+     * deque of linked values, which shifts the other values in memory.
+     *
+     * insert(), erase() and splicing a whole list or a single value take
+     * constant time. The list does not own its values: they have to be
+     * removed from the list before they are destroyed, and the list has to
+     * be empty or cleared before it is destroyed. Unless ESTL_NO_ASSERT
+     * is defined, this is checked, as well as inserting a value that is
+     * already in a list and removing a value whose neighbours do not point
+     * to it.
+     *
+     * \tparam  T       Type of the values.
+     * \tparam  Hook    intrusive_list_base_hook or intrusive_list_member_hook
+     *                  telling where the links of a value are.
+     *
+     * \section intrusive_list_example Usage example
+     * \code{.cpp}
+     * class Task : public esrlabs::estd::intrusive_list_hook<>
+     * {
+     * public:
+     *     esrlabs::estd::intrusive_list_hook<> waitHook;
+     * };
+     *
+     * Task tasks[16];
+     * esrlabs::estd::intrusive_list<Task> ready;
+     * esrlabs::estd::intrusive_list<Task,
+     *     esrlabs::estd::intrusive_list_member_hook<Task, &Task::waitHook> > waiting;
+     *
+     * void wake(Task& task)
+     * {
+     *     waiting.erase(task);
+     *     ready.push_back(task);
+     * }
+     * \endcode
+     */
+    template<class T, class Hook = intrusive_list_base_hook<T> >
+    class intrusive_list
+    {
+        UNCOPYABLE(intrusive_list);
+
+    public:
+        /** The template parameter T */
+        typedef T              value_type;
+        /** A reference to the template parameter T */
+        typedef T&             reference;
+        /** A const reference to the template parameter T */
+        typedef const T&       const_reference;
+        /** A pointer to the template parameter T */
+        typedef T*             pointer;
+        /** A const pointer to the template parameter T */
+        typedef const T*       const_pointer;
+        /** An unsigned integral type for the size */
+        typedef std::size_t    size_type;
+        /** A signed integral type */
+        typedef std::ptrdiff_t difference_type;
+        /** A bidirectional iterator */
+        typedef internal::intrusive_list_iterator<T, Hook, T> iterator;
+        /** A const bidirectional iterator */
+        typedef internal::intrusive_list_iterator<T, Hook, const T> const_iterator;
+        /** A bidirectional reverse iterator */
+        typedef std::reverse_iterator<iterator> reverse_iterator;
+        /** A const bidirectional reverse iterator */
+        typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+        /**
+         * Constructs an empty list.
+         */
+        intrusive_list();
+
+        /**
+         * Destroys the list.
+         *
+         * \assert{empty()}
+         */
+        ~intrusive_list();
+
+        /** Returns an iterator to the first value. */
+        iterator begin() { return iterator(_root._next); }
+        /** Returns a const iterator to the first value. */
+        const_iterator begin() const { return const_iterator(_root._next); }
+        /** Returns a const iterator to the first value. */
+        const_iterator cbegin() const { return begin(); }
+        /** Returns an iterator behind the last value. */
+        iterator end() { return iterator(&_root); }
+        /** Returns a const iterator behind the last value. */
+        const_iterator end() const { return const_iterator(const_cast<internal::intrusive_list_node*>(&_root)); }
+        /** Returns a const iterator behind the last value. */
+        const_iterator cend() const { return end(); }
+        /** Returns a reverse iterator to the last value. */
+        reverse_iterator rbegin() { return reverse_iterator(end()); }
+        /** Returns a const reverse iterator to the last value. */
+        const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+        /** Returns a reverse iterator before the first value. */
+        reverse_iterator rend() { return reverse_iterator(begin()); }
+        /** Returns a const reverse iterator before the first value. */
+        const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+        /**
+         * Returns the number of values.
+         *
+         * \complexity Constant
+         */
+        size_type size() const { return _size; }
+
+        /**
+         * Returns true if there are no values.
+         *
+         * \complexity Constant
+         */
+        bool empty() const { return _size == 0; }
+
+        /**
+         * Returns the first value.
+         *
+         * \assert{!empty()}
+         */
+        reference front();
+        /** \copydoc front() */
+        const_reference front() const;
+
+        /**
+         * Returns the last value.
+         *
+         * \assert{!empty()}
+         */
+        reference back();
+        /** \copydoc back() */
+        const_reference back() const;
+
+        /**
+         * Returns an iterator to value, which has to be in this list.
+         *
+         * \complexity Constant
+         */
+        iterator iterator_to(reference value);
+        /** \copydoc iterator_to() */
+        const_iterator iterator_to(const_reference value) const;
+
+        /**
+         * Adds value in front of the first value.
+         *
+         * \assert{value is not in a list}
+         * \complexity Constant
+         */
+        void push_front(reference value);
+
+        /**
+         * Adds value behind the last value.
+         *
+         * \assert{value is not in a list}
+         * \complexity Constant
+         */
+        void push_back(reference value);
+
+        /**
+         * Removes the first value.
+         *
+         * \assert{!empty()}
+         * \complexity Constant
+         */
+        void pop_front();
+
+        /**
+         * Removes the last value.
+         *
+         * \assert{!empty()}
+         * \complexity Constant
+         */
+        void pop_back();
+
+        /**
+         * Inserts value in front of position.
+         *
+         * \return An iterator to value.
+         * \assert{value is not in a list}
+         * \complexity Constant
+         */
+        iterator insert(const_iterator position, reference value);
+
+        /**
+         * Removes the value at position.
+         *
+         * \return An iterator to the value following the removed one.
+         * \complexity Constant
+         */
+        iterator erase(const_iterator position);
+
+        /**
+         * Removes the values in the range [first, last).
+         *
+         * \return last
+         * \complexity Linear in the number of removed values.
+         */
+        iterator erase(const_iterator first, const_iterator last);
+
+        /**
+         * Removes value, which has to be in this list.
+         *
+         * \complexity Constant
+         */
+        void erase(reference value);
+
+        /**
+         * Removes all values.
+         *
+         * \complexity Linear in size().
+         */
+        void clear();
+
+        /**
+         * Moves all values of other in front of position.
+         *
+         * \complexity Constant
+         */
+        void splice(const_iterator position, intrusive_list& other);
+
+        /**
+         * Moves the value at i of other in front of position.
+         *
+         * \complexity Constant
+         */
+        void splice(const_iterator position, intrusive_list& other, const_iterator i);
+
+        /**
+         * Moves the values in the range [first, last) of other in front of
+         * position, which must not be in the range.
+         *
+         * \complexity Constant if other is this list, otherwise linear in
+         * the number of moved values.
+         */
+        void splice(
+            const_iterator position,
+            intrusive_list& other,
+            const_iterator first,
+            const_iterator last);
+
+    private:
+        typedef internal::intrusive_list_node node;
+
+        static node* to_node(const_reference value);
+
+        static void link(node* position, node* first, node* last);
+
+        static void unlink(node* first, node* last);
+
+        internal::intrusive_list_node _root;
+        size_type _size;
+    };
+
+    namespace internal
+    {
+        /// \cond INTERNAL
+        /*
+         * Bidirectional iterator over the values of an intrusive_list, Value
+         * is T or const T.
+         */
+        template<class T, class Hook, class Value>
+        class intrusive_list_iterator
+        {
+        public:
+            typedef std::bidirectional_iterator_tag iterator_category;
+            typedef T                               value_type;
+            typedef std::ptrdiff_t                  difference_type;
+            typedef Value*                          pointer;
+            typedef Value&                          reference;
+
+            intrusive_list_iterator() : _node(0) {}
+
+            explicit intrusive_list_iterator(intrusive_list_node* n) : _node(n) {}
+
+            // iterator to const_iterator
+            intrusive_list_iterator(const intrusive_list_iterator<T, Hook, T>& other)
+            :   _node(other.node())
+            {}
+
+            reference operator*() const { return Hook::to_value(_node); }
+
+            pointer operator->() const { return &Hook::to_value(_node); }
+
+            intrusive_list_iterator& operator++() { _node = _node->_next; return *this; }
+
+            intrusive_list_iterator operator++(int)
+            {
+                intrusive_list_iterator const result(*this);
+                _node = _node->_next;
+                return result;
+            }
+
+            intrusive_list_iterator& operator--() { _node = _node->_prev; return *this; }
+
+            intrusive_list_iterator operator--(int)
+            {
+                intrusive_list_iterator const result(*this);
+                _node = _node->_prev;
+                return result;
+            }
+
+            template<class OtherValue>
+            bool operator==(const intrusive_list_iterator<T, Hook, OtherValue>& other) const
+            {
+                return _node == other.node();
+            }
+
+            template<class OtherValue>
+            bool operator!=(const intrusive_list_iterator<T, Hook, OtherValue>& other) const
+            {
+                return _node != other.node();
+            }
+
+            intrusive_list_node* node() const { return _node; }
+
+        private:
+            intrusive_list_node* _node;
+        };
+        /// \endcond
+    } /* namespace internal */
+
+/*
+ *
+ * Implementation of intrusive_list
+ *
+ */
+
+template<class T, class H>
+intrusive_list<T, H>::intrusive_list()
+:   _root()
+,   _size(0)
+{
+    _root._prev = &_root;
+    _root._next = &_root;
+}
+
+template<class T, class H>
+intrusive_list<T, H>::~intrusive_list()
+{
+    estd_assert(empty());
+    // lets the root pass the check of its own destructor
+    _root._prev = 0;
+    _root._next = 0;
+}
+
+template<class T, class H>inline
+typename intrusive_list<T, H>::reference
+intrusive_list<T, H>::front()
+{
+    estd_assert(!empty());
+    return H::to_value(_root._next);
+}
+
+template<class T, class H>inline
+typename intrusive_list<T, H>::const_reference
+intrusive_list<T, H>::front() const
+{
+    estd_assert(!empty());
+    return H::to_value(_root._next);
+}
+
+template<class T, class H>inline
+typename intrusive_list<T, H>::reference
+intrusive_list<T, H>::back()
+{
+    estd_assert(!empty());
+    return H::to_value(_root._prev);
+}
+
+template<class T, class H>inline
+typename intrusive_list<T, H>::const_reference
+intrusive_list<T, H>::back() const
+{
+    estd_assert(!empty());
+    return H::to_value(_root._prev);
+}
+
+template<class T, class H>inline
+typename intrusive_list<T, H>::iterator
+intrusive_list<T, H>::iterator_to(reference value)
+{
+    estd_assert(to_node(value)->is_linked());
+    return iterator(to_node(value));
+}
+
+template<class T, class H>inline
+typename intrusive_list<T, H>::const_iterator
+intrusive_list<T, H>::iterator_to(const_reference value) const
+{
+    estd_assert(to_node(value)->is_linked());
+    return const_iterator(to_node(value));
+}
+
+template<class T, class H>inline
+void
+intrusive_list<T, H>::push_front(reference value)
+{
+    (void)insert(begin(), value);
+}
+
+template<class T, class H>inline
+void
+intrusive_list<T, H>::push_back(reference value)
+{
+    (void)insert(end(), value);
+}
+
+template<class T, class H>inline
+void
+intrusive_list<T, H>::pop_front()
+{
+    estd_assert(!empty());
+    (void)erase(begin());
+}
+
+template<class T, class H>inline
+void
+intrusive_list<T, H>::pop_back()
+{
+    estd_assert(!empty());
+    (void)erase(const_iterator(_root._prev));
+}
+
+template<class T, class H>inline
+typename intrusive_list<T, H>::iterator
+intrusive_list<T, H>::insert(const_iterator position, reference value)
+{
+    node* const n = to_node(value);
+    estd_assert(!n->is_linked());
+    link(position.node(), n, n);
+    ++_size;
+    return iterator(n);
+}
+
+template<class T, class H>inline
+typename intrusive_list<T, H>::iterator
+intrusive_list<T, H>::erase(const_iterator position)
+{
+    node* const n = position.node();
+    estd_assert(n != &_root);
+    node* const next = n->_next;
+    unlink(n, n);
+    n->_prev = 0;
+    n->_next = 0;
+    --_size;
+    return iterator(next);
+}
+
+template<class T, class H>
+typename intrusive_list<T, H>::iterator
+intrusive_list<T, H>::erase(const_iterator first, const_iterator last)
+{
+    while (first != last)
+    {
+        first = erase(first);
+    }
+    return iterator(last.node());
+}
+
+template<class T, class H>inline
+void
+intrusive_list<T, H>::erase(reference value)
+{
+    (void)erase(iterator_to(value));
+}
+
+template<class T, class H>
+void
+intrusive_list<T, H>::clear()
+{
+    // resets the links, so the values can be inserted again
+    node* n = _root._next;
+    while (n != &_root)
+    {
+        node* const next = n->_next;
+        n->_prev = 0;
+        n->_next = 0;
+        n = next;
+    }
+    _root._prev = &_root;
+    _root._next = &_root;
+    _size = 0;
+}
+
+template<class T, class H>
+void
+intrusive_list<T, H>::splice(const_iterator position, intrusive_list& other)
+{
+    if ((&other == this) || other.empty())
+    {
+        return;
+    }
+    node* const first = other._root._next;
+    node* const last = other._root._prev;
+    unlink(first, last);
+    link(position.node(), first, last);
+    _size += other._size;
+    other._size = 0;
+}
+
+template<class T, class H>
+void
+intrusive_list<T, H>::splice(const_iterator position, intrusive_list& other, const_iterator i)
+{
+    node* const n = i.node();
+    if ((n == position.node()) || (n->_next == position.node()))
+    {
+        // already in place
+        return;
+    }
+    unlink(n, n);
+    link(position.node(), n, n);
+    --other._size;
+    ++_size;
+}
+
+template<class T, class H>
+void
+intrusive_list<T, H>::splice(
+    const_iterator position,
+    intrusive_list& other,
+    const_iterator first,
+    const_iterator last)
+{
+    if ((first == last) || (position == last))
+    {
+        return;
+    }
+    if (&other != this)
+    {
+        size_type const n = static_cast<size_type>(std::distance(first, last));
+        other._size -= n;
+        _size += n;
+    }
+    node* const firstNode = first.node();
+    node* const lastNode = last.node()->_prev;
+    unlink(firstNode, lastNode);
+    link(position.node(), firstNode, lastNode);
+}
+
+template<class T, class H>inline
+typename intrusive_list<T, H>::node*
+intrusive_list<T, H>::to_node(const_reference value)
+{
+    return H::to_node(const_cast<reference>(value));
+}
+
+/*
+ * Links the chain [first, last] in front of position.
+ */
+template<class T, class H>inline
+void
+intrusive_list<T, H>::link(node* position, node* first, node* last)
+{
+    node* const prev = position->_prev;
+    prev->_next = first;
+    first->_prev = prev;
+    last->_next = position;
+    position->_prev = last;
+}
+
+/*
+ * Unlinks the chain [first, last] from its neighbours, whose links have to
+ * point to it.
+ */
+template<class T, class H>inline
+void
+intrusive_list<T, H>::unlink(node* first, node* last)
+{
+    estd_assert(first->is_linked());
+    estd_assert(first->_prev->_next == first);
+    estd_assert(last->_next->_prev == last);
+    first->_prev->_next = last->_next;
+    last->_next->_prev = first->_prev;
+}
+
+} /* namespace estd */
+
+} /* namespace esrlabs */
+
+#endif /* ESTD_INTRUSIVE_LIST_H */
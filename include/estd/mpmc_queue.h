@@ -0,0 +1,439 @@
+/**
+ * Contains esrlabs::estd::mpmc_queue and esrlabs::estd::declare::mpmc_queue.
+ * \file
+ * \ingroup estl
+ * \copyright   E.S.R.Labs AG, 2014, All rights reserved.
+ */
+#ifndef ESTD_MPMC_QUEUE_H
+#define ESTD_MPMC_QUEUE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <new>
+#include <estd/assert.h>
+#include <estd/atomic.h>
+#include <estd/type_traits.h>
+#include <estd/uncopyable.h>
+
+namespace esrlabs {
+namespace estd {
+
+    namespace internal
+    {
+        /// \cond INTERNAL
+        /*
+         * A slot of the mpmc_queue. The sequence tells which lap of the
+         * producers or consumers may access the slot next.
+         */
+        template<class T>
+        struct mpmc_cell
+        {
+            explicit mpmc_cell(size_t sequence_) : sequence(sequence_) {}
+
+            T* value() { return reinterpret_cast<T*>(storage.data); }
+
+            atomic<size_t> sequence;
+            typename aligned_storage<sizeof(T), alignment_of<T>::value>::type storage;
+        };
+        /// \endcond
+    } /* namespace internal */
+
+    /**
+     * A fixed-sized, lock-free queue for any number of producer and consumer
+     * threads.
+     *
+     * Every slot carries a sequence number telling whether it is ready for
+     * the next producer or the next consumer. Threads claim a slot with a
+     * single compare and swap on the enqueue or dequeue position and only
+     * contend with threads of the same side. The number of slots must be a
+     * power of two.
+     *
+     * \tparam  T   Type of values of this queue.
+     *
+     * \section mpmc_queue_example Usage example
+     * \code{.cpp}
+     * esrlabs::estd::declare::mpmc_queue<Event, 1024> bus;
+     *
+     * void worker()
+     * {
+     *     if (!bus.try_enqueue(Event(EVENT_DONE)))
+     *     {
+     *         ++droppedEvents;
+     *     }
+     * }
+     *
+     * void dispatcher()
+     * {
+     *     Event events[32];
+     *     size_t const count = bus.try_dequeue_n(events, 32);
+     *     dispatch(events, count);
+     * }
+     * \endcode
+     *
+     * \see esrlabs::estd::declare::mpmc_queue
+     */
+    template<class T>
+    class mpmc_queue
+    {
+        UNCOPYABLE(mpmc_queue);
+
+    public:
+        /** The template parameter T */
+        typedef T              value_type;
+        /** A reference to the template parameter T */
+        typedef T&             reference;
+        /** A const reference to the template parameter T */
+        typedef const T&       const_reference;
+        /** A pointer to the template parameter T */
+        typedef T*             pointer;
+        /** A const pointer to the template parameter T */
+        typedef const T*       const_pointer;
+        /** An unsigned integral type for the size */
+        typedef std::size_t    size_type;
+
+        /**
+         * A simple destructor. This destructor does not call the contained
+         * object destructors. The derived class mpmc_queue will call the
+         * destructors on any objects in the queue.
+         */
+        ~mpmc_queue();
+
+        /**
+         * Returns maximum number of elements this queue can hold.
+         *
+         * \complexity Constant
+         */
+        size_type max_size() const;
+
+        /**
+         * Returns the number of elements in this queue. The value is only
+         * a snapshot if other threads are working on the queue.
+         *
+         * \complexity Constant
+         */
+        size_type size() const;
+
+        /**
+         * Returns true if the queue has no elements. The value is only a
+         * snapshot if other threads are working on the queue.
+         *
+         * \complexity Constant
+         */
+        bool empty() const;
+
+        /**
+         * Copies value into the queue.
+         *
+         * \param value The value to copy into this queue.
+         * \return false if the queue is full.
+         * \complexity Constant if there is no contention.
+         */
+        bool try_enqueue(const_reference value);
+
+        /**
+         * Copies up to n values into the queue. The slots for all values
+         * are claimed at once.
+         *
+         * \param values The values to copy into this queue.
+         * \param n The number of values.
+         * \return The number of values added.
+         * \complexity Linear in the number of values added if there is no contention.
+         */
+        size_type try_enqueue_n(const_pointer values, size_type n);
+
+        /**
+         * Copies the oldest element into value and removes it from the queue.
+         *
+         * \param value The value receiving the element.
+         * \return false if the queue is empty.
+         * \complexity Constant if there is no contention.
+         */
+        bool try_dequeue(reference value);
+
+        /**
+         * Copies up to n of the oldest elements into values and removes them
+         * from the queue. The slots of all elements are claimed at once.
+         *
+         * \param values The array receiving the elements.
+         * \param n The size of the array.
+         * \return The number of elements removed.
+         * \complexity Linear in the number of elements removed if there is no contention.
+         */
+        size_type try_dequeue_n(pointer values, size_type n);
+
+    protected:
+        typedef internal::mpmc_cell<T> cell;
+
+        /**
+         * Constructor to initialize this queue with the actual data to work with.
+         * Used by the declare class.
+         *
+         * \param data The actual data for this queue
+         * \param size The size of the data array
+         * \assert{The data holds a power of two number of slots.}
+         */
+        mpmc_queue(uint8_t data[], size_type size);
+
+        /**
+         * Destroys all elements. Must not be called concurrently.
+         */
+        void clear();
+
+    private:
+        static std::ptrdiff_t difference(size_type sequence, size_type position);
+
+        cell& at(size_type position) const;
+
+        size_type claim(atomic<size_type>& position, size_type lap, size_type n, size_type& first);
+
+        // shared, read only
+        cell* _cells;
+        size_type _mask;
+        char _pad0[ESTD_CACHE_LINE_SIZE];
+
+        // written by the producers
+        atomic<size_type> _enqueuePosition;
+        char _pad1[ESTD_CACHE_LINE_SIZE];
+
+        // written by the consumers
+        atomic<size_type> _dequeuePosition;
+        char _pad2[ESTD_CACHE_LINE_SIZE];
+    };
+
+    /*
+     * namespace to declare a mpmc_queue
+     */
+    namespace declare
+    {
+
+        /**
+         * Multi producer, multi consumer queue with static size.
+         *
+         * \tparam  T   Type of values of this queue.
+         * \tparam  N   Maximum number of values in this queue, a power of two
+         *              of at least 2, which is checked at compile time.
+         */
+        template<class T, std::size_t N>
+        class mpmc_queue
+        :   public ::esrlabs::estd::mpmc_queue<T>
+        {
+        public:
+            typedef ::esrlabs::estd::mpmc_queue<T> base;
+
+            /**
+             * Constructs an empty queue.
+             */
+            mpmc_queue();
+
+            /**
+             * Calls the destructor on all contained objects.
+             */
+            ~mpmc_queue();
+
+        private:
+            typedef char size_has_to_be_a_power_of_2[
+                ((N >= 2) && ((N & (N - 1)) == 0)) ? 1 : -1];
+
+            typedef typename base::cell cell;
+
+            typename aligned_storage<sizeof(cell) * N, alignment_of<cell>::value>::type _data;
+        };
+
+    } /* namespace declare */
+
+/*
+ *
+ * Implementation of mpmc_queue
+ *
+ */
+
+template<class T>
+mpmc_queue<T>::mpmc_queue(uint8_t data[], size_type size)
+:   _cells(reinterpret_cast<cell*>(data))
+,   _mask((size / sizeof(cell)) - 1)
+,   _enqueuePosition(0)
+,   _dequeuePosition(0)
+{
+    size_type const slots = _mask + 1;
+    estd_assert((slots > 1) && ((slots & _mask) == 0));
+    for (size_type i = 0; i < slots; ++i)
+    {
+        (void)new(&_cells[i])cell(i);
+    }
+}
+
+template<class T>
+mpmc_queue<T>::~mpmc_queue()
+{
+
+}
+
+template<class T>inline
+std::ptrdiff_t
+mpmc_queue<T>::difference(size_type sequence, size_type position)
+{
+    // positions wrap around, so compare them by their signed distance
+    return static_cast<std::ptrdiff_t>(sequence - position);
+}
+
+template<class T>inline
+typename mpmc_queue<T>::cell&
+mpmc_queue<T>::at(size_type position) const
+{
+    return _cells[position & _mask];
+}
+
+/*
+ * Claims up to n consecutive slots. A slot is ready when its sequence
+ * equals its position plus lap, which is 0 for producers and 1 for
+ * consumers. Returns the number of claimed slots, the first one is
+ * returned in first.
+ */
+template<class T>
+typename mpmc_queue<T>::size_type
+mpmc_queue<T>::claim(atomic<size_type>& position, size_type lap, size_type n, size_type& first)
+{
+    first = position.load(memory_order_relaxed);
+    for (;;)
+    {
+        size_type count = 0;
+        std::ptrdiff_t diff = 0;
+        while (count < n)
+        {
+            size_type const sequence = at(first + count).sequence.load(memory_order_acquire);
+            diff = difference(sequence, first + count + lap);
+            if (diff != 0)
+            {
+                break;
+            }
+            ++count;
+        }
+        if (count > 0)
+        {
+            // on failure first is updated to the current position
+            if (position.compare_exchange_weak(first, first + count, memory_order_relaxed))
+            {
+                return count;
+            }
+        }
+        else if (diff < 0)
+        {
+            // the queue is full or empty
+            return 0;
+        }
+        else
+        {
+            // another thread has claimed the slot in the meantime
+            first = position.load(memory_order_relaxed);
+        }
+    }
+}
+
+template<class T>inline
+typename mpmc_queue<T>::size_type
+mpmc_queue<T>::max_size() const
+{
+    return _mask + 1;
+}
+
+template<class T>inline
+typename mpmc_queue<T>::size_type
+mpmc_queue<T>::size() const
+{
+    size_type const head = _dequeuePosition.load(memory_order_acquire);
+    size_type const tail = _enqueuePosition.load(memory_order_acquire);
+    std::ptrdiff_t const diff = difference(tail, head);
+    return (diff <= 0) ? 0 : std::min(static_cast<size_type>(diff), max_size());
+}
+
+template<class T>inline
+bool
+mpmc_queue<T>::empty() const
+{
+    return size() == 0;
+}
+
+template<class T>
+bool
+mpmc_queue<T>::try_enqueue(const_reference value)
+{
+    return try_enqueue_n(&value, 1) == 1;
+}
+
+template<class T>
+bool
+mpmc_queue<T>::try_dequeue(reference value)
+{
+    return try_dequeue_n(&value, 1) == 1;
+}
+
+template<class T>
+typename mpmc_queue<T>::size_type
+mpmc_queue<T>::try_enqueue_n(const_pointer values, size_type n)
+{
+    size_type first = 0;
+    n = claim(_enqueuePosition, 0, n, first);
+    for (size_type i = 0; i < n; ++i)
+    {
+        cell& c = at(first + i);
+        (void)new(c.value())T(values[i]);
+        // hand the slot over to the consumers
+        c.sequence.store(first + i + 1, memory_order_release);
+    }
+    return n;
+}
+
+template<class T>
+typename mpmc_queue<T>::size_type
+mpmc_queue<T>::try_dequeue_n(pointer values, size_type n)
+{
+    size_type first = 0;
+    n = claim(_dequeuePosition, 1, n, first);
+    for (size_type i = 0; i < n; ++i)
+    {
+        cell& c = at(first + i);
+        values[i] = *c.value();
+        c.value()->~T();
+        // hand the slot over to the producers of the next lap
+        c.sequence.store(first + i + _mask + 1, memory_order_release);
+    }
+    return n;
+}
+
+template<class T>
+void
+mpmc_queue<T>::clear()
+{
+    size_type position = _dequeuePosition.load(memory_order_relaxed);
+    size_type const end = _enqueuePosition.load(memory_order_relaxed);
+    for (; position != end; ++position)
+    {
+        cell& c = at(position);
+        c.value()->~T();
+        c.sequence.store(position + _mask + 1, memory_order_relaxed);
+    }
+    _dequeuePosition.store(end, memory_order_relaxed);
+}
+
+namespace declare
+{
+
+    template<class T, std::size_t N>
+    mpmc_queue<T, N>::mpmc_queue()
+    // _data must not be value initialized, the base has set up the cells
+    :   ::esrlabs::estd::mpmc_queue<T>(_data.data, sizeof(cell) * N)
+    {}
+
+    template<class T, std::size_t N>
+    mpmc_queue<T, N>::~mpmc_queue()
+    {
+        base::clear();
+    }
+
+} /* namespace declare */
+
+} /* namespace estd */
+
+} /* namespace esrlabs */
+
+#endif
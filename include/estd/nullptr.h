@@ -135,8 +135,12 @@ namespace internal
     /// \endcond
 } /* namespace internal */
 
+#if __cplusplus < 201103L
+// C++11 has the keyword, which must not be replaced as the standard library
+// relies on std::nullptr_t, e.g. when nullptr is forwarded to a constructor
 #undef nullptr
 #define nullptr ::esrlabs::estd::internal::get_nullptr()
+#endif
 
 } /* namespace estd */
 
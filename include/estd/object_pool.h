@@ -0,0 +1,489 @@
+/**
+ * Contains esrlabs::estd::object_pool and esrlabs::estd::declare::object_pool.
+ * \file
+ * \ingroup estl
+ * \copyright   E.S.R.Labs AG, 2014, All rights reserved.
+ */
+#ifndef ESTD_OBJECT_POOL_H
+#define ESTD_OBJECT_POOL_H
+
+#include <cstring>
+#include <estd/assert.h>
+#include <estd/constructor.h>
+#include <estd/type_traits.h>
+#include <estd/uncopyable.h>
+
+namespace esrlabs {
+namespace estd {
+
+    /**
+     * A fixed-sized pool of objects of type T, for objects whose lifetime
+     * does not follow the push and pop order of a vector.
+     *
+     * Free slots are linked in an intrusive free list stored in the slots
+     * themselves, so allocate() and release() take constant time and need
+     * no additional memory besides one bit per slot marking the allocated
+     * ones. Slots that have never been used are taken from the end of the
+     * used part of the storage, so constructing a pool is cheap as well.
+     *
+     * Objects can also be referred to by their index in the pool, which is
+     * stable for the lifetime of the object and usually smaller than a
+     * pointer.
+     *
+     * \tparam  T   Type of the objects of this pool.
+     *
+     * \section object_pool_example Usage example
+     * \code{.cpp}
+     * esrlabs::estd::declare::object_pool<Connection, 16> connections;
+     *
+     * Connection* open(uint32_t address)
+     * {
+     *     if (connections.full())
+     *     {
+     *         return 0L;
+     *     }
+     *     return &connections.allocate().construct(address);
+     * }
+     *
+     * void close(Connection* connection)
+     * {
+     *     connections.release(connection);
+     * }
+     * \endcode
+     *
+     * \see esrlabs::estd::declare::object_pool
+     */
+    template<class T>
+    class object_pool
+    {
+        UNCOPYABLE(object_pool);
+
+    public:
+        /** The template parameter T */
+        typedef T              value_type;
+        /** A reference to the template parameter T */
+        typedef T&             reference;
+        /** A const reference to the template parameter T */
+        typedef const T&       const_reference;
+        /** A pointer to the template parameter T */
+        typedef T*             pointer;
+        /** A const pointer to the template parameter T */
+        typedef const T*       const_pointer;
+        /** An unsigned integral type for the size */
+        typedef std::size_t    size_type;
+
+        /**
+         * The size of a slot in bytes. A slot has to hold an object or the
+         * index of the next free slot.
+         */
+        static const size_type SLOT_SIZE = (sizeof(T) >= sizeof(size_type))
+            ? sizeof(T)
+            : ((sizeof(size_type) + alignment_of<T>::value - 1)
+                / alignment_of<T>::value * alignment_of<T>::value);
+
+        /**
+         * A simple destructor. This destructor does not call the allocated
+         * object destructors. The derived class object_pool will call the
+         * destructors on any allocated objects.
+         */
+        ~object_pool();
+
+        /**
+         * Returns the number of allocated objects.
+         *
+         * \complexity Constant
+         */
+        size_type size() const;
+
+        /**
+         * Returns maximum number of objects this pool can hold.
+         *
+         * \complexity Constant
+         */
+        size_type max_size() const;
+
+        /**
+         * Returns true if no object is allocated.
+         *
+         * \complexity Constant
+         */
+        bool empty() const;
+
+        /**
+         * Returns true if no more objects can be allocated.
+         *
+         * \complexity Constant
+         */
+        bool full() const;
+
+        /**
+         * Returns the maximum number of objects which have been allocated
+         * at the same time since the pool has been constructed or the mark
+         * has been reset.
+         *
+         * \complexity Constant
+         */
+        size_type high_water_mark() const;
+
+        /**
+         * Sets the high water mark to the current size.
+         */
+        void reset_high_water_mark();
+
+        /**
+         * Returns a constructor object to a free slot of this pool. The slot
+         * counts as allocated from now on, so the object has to be
+         * constructed before the pool is used again.
+         *
+         * \return A constructor object that can be used to initialize an object.
+         * \assert{!full()}
+         * \complexity Constant
+         */
+        constructor<T> allocate();
+
+        /**
+         * Destroys an allocated object and returns its slot to the pool.
+         *
+         * \param object An object allocated from this pool.
+         * \assert{is_allocated(index_of(object))}
+         * \complexity Constant
+         */
+        void release(pointer object);
+
+        /**
+         * Destroys the allocated object with the given index and returns
+         * its slot to the pool.
+         *
+         * \assert{is_allocated(index)}
+         * \complexity Constant
+         */
+        void release_at(size_type index);
+
+        /**
+         * Returns true if the object lies in the storage of this pool.
+         *
+         * \complexity Constant
+         */
+        bool owns(const_pointer object) const;
+
+        /**
+         * Returns the index of an object of this pool.
+         *
+         * \assert{owns(object)}
+         * \complexity Constant
+         */
+        size_type index_of(const_pointer object) const;
+
+        /**
+         * Returns true if an object is allocated at the given index.
+         *
+         * \complexity Constant
+         */
+        bool is_allocated(size_type index) const;
+
+        /**
+         * Returns the allocated object with the given index.
+         *
+         * \assert{is_allocated(index)}
+         * \complexity Constant
+         */
+        reference at(size_type index);
+
+        /**
+         * Returns the allocated object with the given index.
+         *
+         * \assert{is_allocated(index)}
+         * \complexity Constant
+         */
+        const_reference at(size_type index) const;
+
+        /**
+         * Destroys all allocated objects.
+         *
+         * \complexity Linear in max_size().
+         */
+        void clear();
+
+    protected:
+        /**
+         * Constructor to initialize this pool with the actual data to work with.
+         * Used by the declare class.
+         *
+         * \param data The actual data for this pool, n slots of SLOT_SIZE bytes
+         * \param allocated A bit per slot marking the allocated objects
+         * \param n The number of slots
+         */
+        object_pool(uint8_t data[], uint8_t allocated[], size_type n);
+
+    private:
+        static const size_type NONE = static_cast<size_type>(-1);
+
+        uint8_t* slot(size_type index) const;
+
+        void set_allocated(size_type index, bool allocated);
+
+        uint8_t* _data;
+        uint8_t* _allocated;
+        size_type _max_size;
+        size_type _size;
+        size_type _high_water_mark;
+        // head of the free list of released slots
+        size_type _free;
+        // slots from here on have never been used
+        size_type _unused;
+    };
+
+    /*
+     * namespace to declare an object_pool
+     */
+    namespace declare
+    {
+
+        /**
+         * Object pool with static size.
+         *
+         * \tparam  T   Type of the objects of this pool.
+         * \tparam  N   Maximum number of objects in this pool.
+         */
+        template<class T, std::size_t N>
+        class object_pool
+        :   public ::esrlabs::estd::object_pool<T>
+        {
+        public:
+            typedef ::esrlabs::estd::object_pool<T> base;
+
+            /**
+             * Constructs an empty pool.
+             */
+            object_pool();
+
+            /**
+             * Calls the destructor on all allocated objects.
+             */
+            ~object_pool();
+
+        private:
+            typename aligned_storage<base::SLOT_SIZE * N, alignment_of<T>::value>::type _data;
+            uint8_t _allocated[(N + 7) / 8];
+        };
+
+    } /* namespace declare */
+
+/*
+ *
+ * Implementation of object_pool
+ *
+ */
+
+template<class T>
+const typename object_pool<T>::size_type object_pool<T>::SLOT_SIZE;
+
+template<class T>
+const typename object_pool<T>::size_type object_pool<T>::NONE;
+
+template<class T>
+object_pool<T>::object_pool(uint8_t data[], uint8_t allocated[], size_type n)
+:   _data(data)
+,   _allocated(allocated)
+,   _max_size(n)
+,   _size(0)
+,   _high_water_mark(0)
+,   _free(NONE)
+,   _unused(0)
+{
+    (void)memset(_allocated, 0, (n + 7) / 8);
+}
+
+template<class T>
+object_pool<T>::~object_pool()
+{
+
+}
+
+template<class T>inline
+uint8_t*
+object_pool<T>::slot(size_type index) const
+{
+    return &_data[SLOT_SIZE * index];
+}
+
+template<class T>inline
+void
+object_pool<T>::set_allocated(size_type index, bool allocated)
+{
+    uint8_t const mask = static_cast<uint8_t>(1U << (index % 8));
+    if (allocated)
+    {
+        _allocated[index / 8] |= mask;
+    }
+    else
+    {
+        _allocated[index / 8] &= static_cast<uint8_t>(~mask);
+    }
+}
+
+template<class T>inline
+typename object_pool<T>::size_type
+object_pool<T>::size() const
+{
+    return _size;
+}
+
+template<class T>inline
+typename object_pool<T>::size_type
+object_pool<T>::max_size() const
+{
+    return _max_size;
+}
+
+template<class T>inline
+bool
+object_pool<T>::empty() const
+{
+    return _size == 0;
+}
+
+template<class T>inline
+bool
+object_pool<T>::full() const
+{
+    return _size == _max_size;
+}
+
+template<class T>inline
+typename object_pool<T>::size_type
+object_pool<T>::high_water_mark() const
+{
+    return _high_water_mark;
+}
+
+template<class T>inline
+void
+object_pool<T>::reset_high_water_mark()
+{
+    _high_water_mark = _size;
+}
+
+template<class T>
+constructor<T>
+object_pool<T>::allocate()
+{
+    estd_assert(!full());
+    size_type index = _free;
+    if (index != NONE)
+    {
+        // the next free index is stored in the unaligned slot memory
+        (void)memcpy(&_free, slot(index), sizeof(_free));
+    }
+    else
+    {
+        index = _unused;
+        ++_unused;
+    }
+    set_allocated(index, true);
+    ++_size;
+    if (_size > _high_water_mark)
+    {
+        _high_water_mark = _size;
+    }
+    return constructor<T>(slot(index));
+}
+
+template<class T>inline
+void
+object_pool<T>::release(pointer object)
+{
+    release_at(index_of(object));
+}
+
+template<class T>
+void
+object_pool<T>::release_at(size_type index)
+{
+    estd_assert(is_allocated(index));
+    reinterpret_cast<pointer>(slot(index))->~T();
+    set_allocated(index, false);
+    (void)memcpy(slot(index), &_free, sizeof(_free));
+    _free = index;
+    --_size;
+}
+
+template<class T>inline
+bool
+object_pool<T>::owns(const_pointer object) const
+{
+    const uint8_t* const p = reinterpret_cast<const uint8_t*>(object);
+    return (p >= _data)
+        && (p < (_data + SLOT_SIZE * _max_size))
+        && ((static_cast<size_type>(p - _data) % SLOT_SIZE) == 0);
+}
+
+template<class T>inline
+typename object_pool<T>::size_type
+object_pool<T>::index_of(const_pointer object) const
+{
+    estd_assert(owns(object));
+    return static_cast<size_type>(reinterpret_cast<const uint8_t*>(object) - _data) / SLOT_SIZE;
+}
+
+template<class T>inline
+bool
+object_pool<T>::is_allocated(size_type index) const
+{
+    return (index < _max_size) && ((_allocated[index / 8] & (1U << (index % 8))) != 0);
+}
+
+template<class T>inline
+typename object_pool<T>::reference
+object_pool<T>::at(size_type index)
+{
+    estd_assert(is_allocated(index));
+    return *reinterpret_cast<pointer>(slot(index));
+}
+
+template<class T>inline
+typename object_pool<T>::const_reference
+object_pool<T>::at(size_type index) const
+{
+    estd_assert(is_allocated(index));
+    return *reinterpret_cast<const_pointer>(slot(index));
+}
+
+template<class T>
+void
+object_pool<T>::clear()
+{
+    for (size_type i = 0; i < _unused; ++i)
+    {
+        if (is_allocated(i))
+        {
+            reinterpret_cast<pointer>(slot(i))->~T();
+        }
+    }
+    (void)memset(_allocated, 0, (_max_size + 7) / 8);
+    _size = 0;
+    _free = NONE;
+    _unused = 0;
+}
+
+namespace declare
+{
+
+    template<class T, std::size_t N>
+    object_pool<T, N>::object_pool()
+    :   ::esrlabs::estd::object_pool<T>(_data.data, _allocated, N)
+    {}
+
+    template<class T, std::size_t N>
+    object_pool<T, N>::~object_pool()
+    {
+        base::clear();
+    }
+
+} /* namespace declare */
+
+} /* namespace estd */
+
+} /* namespace esrlabs */
+
+#endif
@@ -0,0 +1,486 @@
+/**
+ * Contains esrlabs::estd::priority_queue and
+ * esrlabs::estd::declare::priority_queue.
+ * \file
+ * \ingroup estl
+ * \copyright   E.S.R.Labs AG, 2014, All rights reserved.
+ */
+#ifndef ESTD_PRIORITY_QUEUE_H
+#define ESTD_PRIORITY_QUEUE_H
+
+#include <functional>
+#include <estd/assert.h>
+#include <estd/constructor.h>
+#include <estd/vector.h>
+
+namespace esrlabs {
+namespace estd {
+
+    /**
+     * A fixed-sized priority queue, which keeps its values in a heap on top
+     * of an estd::vector. top() is the greatest value with respect to
+     * Compare, so a queue of deadlines ordered by std::greater returns the
+     * earliest deadline first.
+     *
+     * push() and pop() take logarithmic time, building the queue from a
+     * range takes linear time.
+     *
+     * Every node of the heap has Arity children. The default binary heap
+     * needs the fewest comparisons, a 4-ary heap is flatter, so pop() moves
+     * fewer values and the children of a node share a cache line, which
+     * pays off for large queues.
+     *
+     * T has to be copy constructible and copy assignable.
+     *
+     * \tparam  T       Type of the values.
+     * \tparam  Compare Function object ordering the values.
+     * \tparam  Arity   Number of children of a node, at least 2.
+     *
+     * \section priority_queue_example Usage example
+     * \code{.cpp}
+     * esrlabs::estd::declare::priority_queue<Job, 32, LaterDeadline> jobs;
+     *
+     * void schedule(uint32_t deadline, Callback callback)
+     * {
+     *     jobs.emplace().construct(deadline, callback);
+     *     jobs.publish();
+     * }
+     *
+     * void run(uint32_t now)
+     * {
+     *     while (!jobs.empty() && (jobs.top().deadline <= now))
+     *     {
+     *         jobs.top().callback();
+     *         jobs.pop();
+     *     }
+     * }
+     * \endcode
+     *
+     * \see esrlabs::estd::declare::priority_queue
+     */
+    template<class T, class Compare = std::less<T>, std::size_t Arity = 2>
+    class priority_queue
+    {
+    public:
+        /** The template parameter T */
+        typedef T                                   value_type;
+        /** A const reference to the template parameter T */
+        typedef const T&                            const_reference;
+        /** An unsigned integral type for the size */
+        typedef typename vector<T>::size_type       size_type;
+        /** The template parameter Compare */
+        typedef Compare                             value_compare;
+
+        /** The number of children of a node */
+        static const size_type ARITY = Arity;
+
+        /**
+         * Copies the values of the other queue into this queue.
+         *
+         * \assert{other.size() <= max_size()}
+         */
+        priority_queue& operator=(const priority_queue& other);
+
+        /** Returns the number of values. */
+        size_type size() const { return _values.size(); }
+        /** Returns the maximum number of values. */
+        size_type max_size() const { return _values.max_size(); }
+        /** Returns true if there are no values. */
+        bool empty() const { return _values.empty(); }
+        /** Returns true if no more values can be pushed. */
+        bool full() const { return _values.full(); }
+
+        /** Returns the function object ordering the values. */
+        value_compare value_comp() const { return _compare; }
+
+        /**
+         * Returns the greatest value.
+         *
+         * \assert{!empty()}
+         * \complexity Constant
+         */
+        const_reference top() const;
+
+        /**
+         * Adds a copy of value.
+         *
+         * \assert{!full()}
+         * \complexity Logarithmic
+         */
+        void push(const_reference value);
+
+        /**
+         * Returns a constructor object to the memory of a new value. The
+         * value is added to the queue by calling publish() after it has
+         * been constructed, no other method may be called in between.
+         *
+         * \assert{!full()}
+         */
+        constructor<T> emplace();
+
+        /**
+         * Adds the value constructed after the last call of emplace().
+         *
+         * \complexity Logarithmic
+         */
+        void publish();
+
+        /**
+         * Removes the greatest value.
+         *
+         * \assert{!empty()}
+         * \complexity Logarithmic
+         */
+        void pop();
+
+        /**
+         * Replaces the values with those of the range [first, last). Values
+         * that do not fit are dropped.
+         *
+         * \complexity Linear in the size of the range.
+         */
+        template<class InputIterator>
+        void assign(InputIterator first, InputIterator last);
+
+        /**
+         * Adds the values of the range [first, last) at once. Values that
+         * do not fit are dropped.
+         *
+         * \complexity Linear in the resulting size.
+         */
+        template<class InputIterator>
+        void insert(InputIterator first, InputIterator last);
+
+        /** Removes all values. */
+        void clear() { _values.clear(); }
+
+    protected:
+        priority_queue(vector<T>& values, const Compare& comp)
+        :   _values(values)
+        ,   _compare(comp)
+        {}
+
+    private:
+        typedef char arity_has_to_be_at_least_2[(Arity >= 2) ? 1 : -1];
+
+        priority_queue(const priority_queue& other);
+
+        void sift_up(T* values, size_type index, const T& value);
+
+        void sift_down(T* values, size_type size, size_type index, const T& value);
+
+        size_type greatest_child(const T* values, size_type size, size_type index) const;
+
+        void make_heap();
+
+        vector<T>& _values;
+        Compare _compare;
+    };
+
+    /*
+     * namespace to declare a priority queue
+     */
+    namespace declare
+    {
+
+        /**
+         * Priority queue with static size.
+         *
+         * \tparam  T       Type of the values.
+         * \tparam  N       Maximum number of values in this queue.
+         * \tparam  Compare Function object ordering the values.
+         * \tparam  Arity   Number of children of a node, at least 2.
+         */
+        template<class T, std::size_t N, class Compare = std::less<T>, std::size_t Arity = 2>
+        class priority_queue
+        :   public ::esrlabs::estd::priority_queue<T, Compare, Arity>
+        {
+        public:
+            typedef ::esrlabs::estd::priority_queue<T, Compare, Arity> base;
+            typedef ::esrlabs::estd::declare::priority_queue<T, N, Compare, Arity> this_type;
+
+            /**
+             * Constructs an empty queue.
+             */
+            explicit priority_queue(const Compare& comp = Compare());
+
+            /**
+             * Constructs a queue from the values of the range [first, last).
+             */
+            template<class InputIterator>
+            priority_queue(InputIterator first, InputIterator last, const Compare& comp = Compare());
+
+            /**
+             * Copies the values of the other queue into this queue.
+             */
+            priority_queue(const base& other);
+
+            /**
+             * Copies the values of the other queue into this queue.
+             */
+            priority_queue(const this_type& other);
+
+            /**
+             * Copies the values of the other queue into this queue.
+             */
+            priority_queue& operator=(const base& other);
+
+            /**
+             * Copies the values of the other queue into this queue.
+             */
+            priority_queue& operator=(const this_type& other);
+
+        private:
+            declare::vector<T, N> _values;
+        };
+
+    } /* namespace declare */
+
+/*
+ *
+ * Implementation of priority_queue
+ *
+ */
+
+template<class T, class C, std::size_t A>
+priority_queue<T, C, A>&
+priority_queue<T, C, A>::operator=(const priority_queue& other)
+{
+    if (&other != this)
+    {
+        _values = other._values;
+        _compare = other._compare;
+    }
+    return *this;
+}
+
+template<class T, class C, std::size_t A>inline
+typename priority_queue<T, C, A>::const_reference
+priority_queue<T, C, A>::top() const
+{
+    estd_assert(!empty());
+    return _values.front();
+}
+
+template<class T, class C, std::size_t A>
+void
+priority_queue<T, C, A>::push(const_reference value)
+{
+    emplace().construct(value);
+    publish();
+}
+
+template<class T, class C, std::size_t A>inline
+constructor<T>
+priority_queue<T, C, A>::emplace()
+{
+    return _values.emplace_back();
+}
+
+template<class T, class C, std::size_t A>inline
+void
+priority_queue<T, C, A>::publish()
+{
+    T const value(_values.back());
+    sift_up(_values.begin(), _values.size() - 1, value);
+}
+
+template<class T, class C, std::size_t A>
+void
+priority_queue<T, C, A>::pop()
+{
+    estd_assert(!empty());
+    if (_values.size() == 1)
+    {
+        _values.pop_back();
+        return;
+    }
+    T const last(_values.back());
+    _values.pop_back();
+    // moves the hole at the root down to a leaf without comparing with the
+    // last value, which mostly belongs there, and sifts it up from there
+    T* const values = _values.begin();
+    size_type const size = _values.size();
+    size_type index = 0;
+    for (;;)
+    {
+        size_type const child = greatest_child(values, size, index);
+        if (child == size)
+        {
+            break;
+        }
+        values[index] = values[child];
+        index = child;
+    }
+    sift_up(values, index, last);
+}
+
+template<class T, class C, std::size_t A>
+template<class InputIterator>
+void
+priority_queue<T, C, A>::assign(InputIterator first, InputIterator last)
+{
+    _values.clear();
+    insert(first, last);
+}
+
+template<class T, class C, std::size_t A>
+template<class InputIterator>
+void
+priority_queue<T, C, A>::insert(InputIterator first, InputIterator last)
+{
+    for (; (first != last) && !_values.full(); ++first)
+    {
+        _values.push_back(*first);
+    }
+    make_heap();
+}
+
+/*
+ * The sifts move a hole instead of swapping values, which copies every
+ * value on the path once.
+ */
+template<class T, class C, std::size_t A>
+void
+priority_queue<T, C, A>::sift_up(T* values, size_type index, const T& value)
+{
+    while (index > 0)
+    {
+        size_type const parent = (index - 1) / A;
+        if (!_compare(values[parent], value))
+        {
+            break;
+        }
+        values[index] = values[parent];
+        index = parent;
+    }
+    values[index] = value;
+}
+
+template<class T, class C, std::size_t A>
+void
+priority_queue<T, C, A>::sift_down(T* values, size_type size, size_type index, const T& value)
+{
+    for (;;)
+    {
+        size_type const child = greatest_child(values, size, index);
+        if ((child == size) || !_compare(value, values[child]))
+        {
+            break;
+        }
+        values[index] = values[child];
+        index = child;
+    }
+    values[index] = value;
+}
+
+template<class T, class C, std::size_t A>inline
+typename priority_queue<T, C, A>::size_type
+priority_queue<T, C, A>::greatest_child(const T* values, size_type size, size_type index) const
+{
+    size_type const first = A * index + 1;
+    if (first >= size)
+    {
+        return size;
+    }
+    size_type greatest = first;
+    if (size - first >= A)
+    {
+        // all children present, a loop of constant length the compiler unrolls
+        for (size_type i = 1; i < A; ++i)
+        {
+            if (_compare(values[greatest], values[first + i]))
+            {
+                greatest = first + i;
+            }
+        }
+        return greatest;
+    }
+    for (size_type child = first + 1; child < size; ++child)
+    {
+        if (_compare(values[greatest], values[child]))
+        {
+            greatest = child;
+        }
+    }
+    return greatest;
+}
+
+/*
+ * Floyd's method: sifting down the inner nodes from the last one to the
+ * root takes linear time, as most nodes are close to the leaves.
+ */
+template<class T, class C, std::size_t A>
+void
+priority_queue<T, C, A>::make_heap()
+{
+    size_type const size = _values.size();
+    if (size < 2)
+    {
+        return;
+    }
+    T* const values = _values.begin();
+    for (size_type index = (size - 2) / A + 1; index > 0; --index)
+    {
+        T const value(values[index - 1]);
+        sift_down(values, size, index - 1, value);
+    }
+}
+
+namespace declare
+{
+
+    template<class T, std::size_t N, class C, std::size_t A>
+    priority_queue<T, N, C, A>::priority_queue(const C& comp)
+    :   base(_values, comp)
+    ,   _values()
+    {}
+
+    template<class T, std::size_t N, class C, std::size_t A>
+    template<class InputIterator>
+    priority_queue<T, N, C, A>::priority_queue(InputIterator first, InputIterator last, const C& comp)
+    :   base(_values, comp)
+    ,   _values()
+    {
+        base::assign(first, last);
+    }
+
+    template<class T, std::size_t N, class C, std::size_t A>
+    priority_queue<T, N, C, A>::priority_queue(const base& other)
+    :   base(_values, other.value_comp())
+    ,   _values()
+    {
+        base::operator=(other);
+    }
+
+    template<class T, std::size_t N, class C, std::size_t A>
+    priority_queue<T, N, C, A>::priority_queue(const this_type& other)
+    :   base(_values, other.value_comp())
+    ,   _values()
+    {
+        base::operator=(other);
+    }
+
+    template<class T, std::size_t N, class C, std::size_t A>
+    priority_queue<T, N, C, A>&
+    priority_queue<T, N, C, A>::operator=(const base& other)
+    {
+        base::operator=(other);
+        return *this;
+    }
+
+    template<class T, std::size_t N, class C, std::size_t A>
+    priority_queue<T, N, C, A>&
+    priority_queue<T, N, C, A>::operator=(const this_type& other)
+    {
+        base::operator=(other);
+        return *this;
+    }
+
+} /* namespace declare */
+
+} /* namespace estd */
+
+} /* namespace esrlabs */
+
+#endif /* ESTD_PRIORITY_QUEUE_H */
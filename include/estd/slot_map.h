@@ -0,0 +1,630 @@
+/**
+ * Contains esrlabs::estd::slot_map and esrlabs::estd::declare::slot_map.
+ * \file
+ * \ingroup estl
+ * \copyright   E.S.R.Labs AG, 2014, All rights reserved.
+ */
+#ifndef ESTD_SLOT_MAP_H
+#define ESTD_SLOT_MAP_H
+
+#include <estd/assert.h>
+#include <estd/constructor.h>
+#include <estd/estdint.h>
+#include <estd/type_traits.h>
+#include <estd/uncopyable.h>
+#include <estd/vector.h>
+
+namespace esrlabs {
+namespace estd {
+
+    /**
+     * A fixed-sized container of values referred to by handles, which stay
+     * valid until their value is erased and never refer to another value
+     * afterwards.
+     *
+     * The values are kept dense and contiguous like in a vector, so
+     * iterating over them is as fast as iterating over a vector. Erasing a
+     * value moves the last value into the gap, so the order of the values
+     * changes and iterators and pointers to the last value become invalid,
+     * but handles do not.
+     *
+     * A handle is a 32-bit value made of the index of a slot, which holds
+     * the position of the value, and the generation of the slot, which is
+     * incremented whenever a value is erased. A handle of an erased value
+     * therefore no longer matches its slot. The lower bits of a handle
+     * hold the index, as many as needed for max_size() slots, the upper
+     * bits hold the generation, which wraps around after 2^(32 - index
+     * bits) erasures of values of the same slot. A handle of 0 is never
+     * valid.
+     *
+     * insert(), emplace(), erase() and the lookups take constant time.
+     *
+     * \tparam  T   Type of values of this slot map.
+     *
+     * \section slot_map_example Usage example
+     * \code{.cpp}
+     * esrlabs::estd::declare::slot_map<Entity, 256> entities;
+     *
+     * uint32_t spawn(Position position)
+     * {
+     *     return entities.handle_of(entities.emplace().construct(position));
+     * }
+     *
+     * void hit(uint32_t entity)
+     * {
+     *     // the entity may have been despawned in the meantime
+     *     Entity* const e = entities.find(entity);
+     *     if (e != 0L)
+     *     {
+     *         e->damage();
+     *     }
+     * }
+     *
+     * void update()
+     * {
+     *     for (Entity* e = entities.begin(); e != entities.end(); ++e)
+     *     {
+     *         e->move();
+     *     }
+     * }
+     * \endcode
+     *
+     * \see esrlabs::estd::declare::slot_map
+     * \see esrlabs::estd::constructor
+     */
+    template<class T>
+    class slot_map
+    {
+        UNCOPYABLE(slot_map);
+
+    public:
+        /** The template parameter T */
+        typedef T              value_type;
+        /** A reference to the template parameter T */
+        typedef T&             reference;
+        /** A const reference to the template parameter T */
+        typedef const T&       const_reference;
+        /** A pointer to the template parameter T */
+        typedef T*             pointer;
+        /** A const pointer to the template parameter T */
+        typedef const T*       const_pointer;
+        /** An unsigned integral type for the size */
+        typedef std::size_t    size_type;
+        /** A random access iterator */
+        typedef pointer        iterator;
+        /** A const random access iterator */
+        typedef const_pointer  const_iterator;
+        /** The type of the handles */
+        typedef uint32_t       handle_type;
+
+        /** A handle that never refers to a value */
+        static const handle_type INVALID_HANDLE = 0U;
+
+        /**
+         * A simple destructor. This destructor does not call the contained
+         * object destructors. The derived class slot_map will call the
+         * destructors on any objects in the slot map.
+         */
+        ~slot_map();
+
+        /**
+         * Returns the number of values.
+         *
+         * \complexity Constant
+         */
+        size_type size() const;
+
+        /**
+         * Returns the maximum number of values.
+         *
+         * \complexity Constant
+         */
+        size_type max_size() const;
+
+        /**
+         * Returns true if there are no values.
+         *
+         * \complexity Constant
+         */
+        bool empty() const;
+
+        /**
+         * Returns true if no more values can be added.
+         *
+         * \complexity Constant
+         */
+        bool full() const;
+
+        /**
+         * Adds a copy of value and returns its handle.
+         *
+         * \assert{!full()}
+         * \complexity Constant
+         */
+        handle_type insert(const_reference value);
+
+        /**
+         * Returns a constructor object to the memory of a new value at the
+         * end of the values. The handle of the value is returned by
+         * handle_of() once it has been constructed.
+         *
+         * \assert{!full()}
+         * \complexity Constant
+         */
+        constructor<T> emplace();
+
+        /**
+         * Returns true if handle refers to a value.
+         *
+         * \complexity Constant
+         */
+        bool contains(handle_type handle) const;
+
+        /**
+         * Returns a pointer to the value of handle, or 0L if the handle
+         * does not refer to a value.
+         *
+         * \complexity Constant
+         */
+        pointer find(handle_type handle);
+
+        /**
+         * Returns a pointer to the value of handle, or 0L if the handle
+         * does not refer to a value.
+         *
+         * \complexity Constant
+         */
+        const_pointer find(handle_type handle) const;
+
+        /**
+         * Returns the value of handle.
+         *
+         * \assert{contains(handle)}
+         * \complexity Constant
+         */
+        reference at(handle_type handle);
+
+        /**
+         * Returns the value of handle.
+         *
+         * \assert{contains(handle)}
+         * \complexity Constant
+         */
+        const_reference at(handle_type handle) const;
+
+        /**
+         * Returns the handle of a value of this slot map.
+         *
+         * \assert{value is one of the values}
+         * \complexity Constant
+         */
+        handle_type handle_of(const_reference value) const;
+
+        /**
+         * Erases the value of handle, if there is one, and moves the last
+         * value into its place.
+         *
+         * \return true if a value has been erased.
+         * \complexity Constant
+         */
+        bool erase(handle_type handle);
+
+        /**
+         * Erases the value at position and moves the last value into its
+         * place. Returns an iterator to the value following the erased
+         * one in the order of iteration, which is position again unless
+         * the last value has been erased.
+         *
+         * \assert{position is a valid iterator}
+         * \complexity Constant
+         */
+        iterator erase(const_iterator position);
+
+        /**
+         * Erases all values. The handles of the values become invalid.
+         *
+         * \complexity Linear in size()
+         */
+        void clear();
+
+        /** Returns an iterator to the beginning */
+        iterator begin();
+
+        /** Returns a const iterator to the beginning */
+        const_iterator begin() const;
+
+        /** Returns a const iterator to the beginning */
+        const_iterator cbegin() const;
+
+        /** Returns an iterator to the end */
+        iterator end();
+
+        /** Returns a const iterator to the end */
+        const_iterator end() const;
+
+        /** Returns a const iterator to the end */
+        const_iterator cend() const;
+
+    protected:
+        /// \cond INTERNAL
+        struct slot
+        {
+            // position of the value, or the next free slot
+            uint32_t position;
+            uint32_t generation;
+        };
+        /// \endcond
+
+        /**
+         * Constructor to initialize this slot map with the actual data to
+         * work with. Used by the declare class.
+         *
+         * \param data The storage of n values
+         * \param slots The n slots
+         * \param keys The index of the slot of each position, n entries
+         * \param n The maximum number of values
+         */
+        slot_map(uint8_t data[], slot slots[], uint32_t keys[], size_type n);
+
+    private:
+        static const uint32_t NONE = 0xFFFFFFFFU;
+
+        pointer values() const;
+
+        handle_type make_handle(uint32_t index) const;
+
+        // returns the position of the value of handle, or NONE
+        uint32_t position_of(handle_type handle) const;
+
+        void erase_at(uint32_t position);
+
+        uint8_t* _data;
+        slot* _slots;
+        uint32_t* _keys;
+        size_type _max_size;
+        size_type _size;
+        uint32_t _index_bits;
+        uint32_t _generation_mask;
+        // head of the free list of slots
+        uint32_t _free;
+        // slots from here on have never been used
+        uint32_t _unused;
+    };
+
+    /*
+     * namespace to declare a slot map
+     */
+    namespace declare
+    {
+
+        /**
+         * Slot map with static size.
+         *
+         * \tparam  T   Type of values of this slot map.
+         * \tparam  N   Maximum number of values, at most 2^24, which leaves
+         *              at least 8 bits of a handle for the generation.
+         */
+        template<class T, std::size_t N>
+        class slot_map
+        :   public ::esrlabs::estd::slot_map<T>
+        {
+        public:
+            typedef ::esrlabs::estd::slot_map<T> base;
+
+            /**
+             * Constructs an empty slot map.
+             */
+            slot_map();
+
+            /**
+             * Calls the destructor on all contained objects.
+             */
+            ~slot_map();
+
+        private:
+            typedef typename base::slot slot;
+
+            typedef char size_has_to_be_between_1_and_2_to_the_24[
+                ((N > 0) && (N <= (1U << 24))) ? 1 : -1];
+
+            typename aligned_storage<sizeof(T) * N, alignment_of<T>::value>::type _data;
+            slot _slots[N];
+            uint32_t _keys[N];
+        };
+
+    } /* namespace declare */
+
+/*
+ *
+ * Implementation of slot_map
+ *
+ */
+
+template<class T>
+const typename slot_map<T>::handle_type slot_map<T>::INVALID_HANDLE;
+
+template<class T>
+const uint32_t slot_map<T>::NONE;
+
+template<class T>
+slot_map<T>::slot_map(uint8_t data[], slot slots[], uint32_t keys[], size_type n)
+:   _data(data)
+,   _slots(slots)
+,   _keys(keys)
+,   _max_size(n)
+,   _size(0)
+,   _index_bits(1)
+,   _generation_mask(0)
+,   _free(NONE)
+,   _unused(0)
+{
+    while ((static_cast<size_type>(1) << _index_bits) < n)
+    {
+        ++_index_bits;
+    }
+    _generation_mask = NONE >> _index_bits;
+}
+
+template<class T>
+slot_map<T>::~slot_map()
+{
+
+}
+
+template<class T>inline
+typename slot_map<T>::pointer
+slot_map<T>::values() const
+{
+    return reinterpret_cast<pointer>(_data);
+}
+
+template<class T>inline
+typename slot_map<T>::handle_type
+slot_map<T>::make_handle(uint32_t index) const
+{
+    return (_slots[index].generation << _index_bits) | index;
+}
+
+template<class T>inline
+uint32_t
+slot_map<T>::position_of(handle_type handle) const
+{
+    uint32_t const index = handle & ((1U << _index_bits) - 1U);
+    if ((index >= _unused) || (_slots[index].generation != (handle >> _index_bits)))
+    {
+        return NONE;
+    }
+    // a free slot holds the next free slot instead of a position
+    uint32_t const position = _slots[index].position;
+    return ((position < _size) && (_keys[position] == index)) ? position : NONE;
+}
+
+template<class T>inline
+typename slot_map<T>::size_type
+slot_map<T>::size() const
+{
+    return _size;
+}
+
+template<class T>inline
+typename slot_map<T>::size_type
+slot_map<T>::max_size() const
+{
+    return _max_size;
+}
+
+template<class T>inline
+bool
+slot_map<T>::empty() const
+{
+    return _size == 0;
+}
+
+template<class T>inline
+bool
+slot_map<T>::full() const
+{
+    return _size == _max_size;
+}
+
+template<class T>
+typename slot_map<T>::handle_type
+slot_map<T>::insert(const_reference value)
+{
+    return handle_of(emplace().construct(value));
+}
+
+template<class T>
+constructor<T>
+slot_map<T>::emplace()
+{
+    estd_assert(!full());
+    uint32_t index = _free;
+    if (index != NONE)
+    {
+        _free = _slots[index].position;
+    }
+    else
+    {
+        index = _unused;
+        ++_unused;
+        _slots[index].generation = 1U;
+    }
+    uint32_t const position = static_cast<uint32_t>(_size);
+    _slots[index].position = position;
+    _keys[position] = index;
+    ++_size;
+    return constructor<T>(reinterpret_cast<uint8_t*>(values() + position));
+}
+
+template<class T>inline
+bool
+slot_map<T>::contains(handle_type handle) const
+{
+    return position_of(handle) != NONE;
+}
+
+template<class T>inline
+typename slot_map<T>::pointer
+slot_map<T>::find(handle_type handle)
+{
+    uint32_t const position = position_of(handle);
+    return (position != NONE) ? (values() + position) : 0L;
+}
+
+template<class T>inline
+typename slot_map<T>::const_pointer
+slot_map<T>::find(handle_type handle) const
+{
+    uint32_t const position = position_of(handle);
+    return (position != NONE) ? (values() + position) : 0L;
+}
+
+template<class T>inline
+typename slot_map<T>::reference
+slot_map<T>::at(handle_type handle)
+{
+    uint32_t const position = position_of(handle);
+    estd_assert(position != NONE);
+    return values()[position];
+}
+
+template<class T>inline
+typename slot_map<T>::const_reference
+slot_map<T>::at(handle_type handle) const
+{
+    uint32_t const position = position_of(handle);
+    estd_assert(position != NONE);
+    return values()[position];
+}
+
+template<class T>inline
+typename slot_map<T>::handle_type
+slot_map<T>::handle_of(const_reference value) const
+{
+    estd_assert((&value >= cbegin()) && (&value < cend()));
+    return make_handle(_keys[&value - cbegin()]);
+}
+
+template<class T>
+bool
+slot_map<T>::erase(handle_type handle)
+{
+    uint32_t const position = position_of(handle);
+    if (position == NONE)
+    {
+        return false;
+    }
+    erase_at(position);
+    return true;
+}
+
+template<class T>
+typename slot_map<T>::iterator
+slot_map<T>::erase(const_iterator position)
+{
+    estd_assert((position >= cbegin()) && (position < cend()));
+    erase_at(static_cast<uint32_t>(position - cbegin()));
+    return iterator(position);
+}
+
+template<class T>
+void
+slot_map<T>::erase_at(uint32_t position)
+{
+    uint32_t const index = _keys[position];
+    slot& s = _slots[index];
+    // the generation 0 is skipped, so a handle of 0 is never valid
+    s.generation = (s.generation + 1U) & _generation_mask;
+    if (s.generation == 0U)
+    {
+        s.generation = 1U;
+    }
+    s.position = _free;
+    _free = index;
+
+    pointer const v = values();
+    v[position].~T();
+    --_size;
+    if (position != _size)
+    {
+        relocate(v + position, v + _size, 1);
+        _keys[position] = _keys[_size];
+        _slots[_keys[position]].position = position;
+    }
+}
+
+template<class T>
+void
+slot_map<T>::clear()
+{
+    // erases from the back, which moves no values
+    while (_size > 0)
+    {
+        erase_at(static_cast<uint32_t>(_size - 1));
+    }
+}
+
+template<class T>inline
+typename slot_map<T>::iterator
+slot_map<T>::begin()
+{
+    return values();
+}
+
+template<class T>inline
+typename slot_map<T>::const_iterator
+slot_map<T>::begin() const
+{
+    return values();
+}
+
+template<class T>inline
+typename slot_map<T>::const_iterator
+slot_map<T>::cbegin() const
+{
+    return values();
+}
+
+template<class T>inline
+typename slot_map<T>::iterator
+slot_map<T>::end()
+{
+    return values() + _size;
+}
+
+template<class T>inline
+typename slot_map<T>::const_iterator
+slot_map<T>::end() const
+{
+    return values() + _size;
+}
+
+template<class T>inline
+typename slot_map<T>::const_iterator
+slot_map<T>::cend() const
+{
+    return values() + _size;
+}
+
+namespace declare
+{
+
+    template<class T, std::size_t N>
+    slot_map<T, N>::slot_map()
+    :   base(_data.data, _slots, _keys, N)
+    {}
+
+    template<class T, std::size_t N>
+    slot_map<T, N>::~slot_map()
+    {
+        base::clear();
+    }
+
+} /* namespace declare */
+
+} /* namespace estd */
+
+} /* namespace esrlabs */
+
+#endif /* ESTD_SLOT_MAP_H */
@@ -0,0 +1,486 @@
+/**
+ * Contains esrlabs::estd::spsc_queue and esrlabs::estd::declare::spsc_queue.
+ * \file
+ * \ingroup estl
+ * \copyright   E.S.R.Labs AG, 2014, All rights reserved.
+ */
+#ifndef ESTD_SPSC_QUEUE_H
+#define ESTD_SPSC_QUEUE_H
+
+#include <algorithm>
+#include <new>
+#include <estd/assert.h>
+#include <estd/atomic.h>
+#include <estd/type_traits.h>
+#include <estd/constructor.h>
+#include <estd/uncopyable.h>
+
+namespace esrlabs {
+namespace estd {
+
+    /**
+     * A fixed-sized, wait-free queue for exactly one producer thread and
+     * one consumer thread.
+     *
+     * The producer only calls full(), try_push(), try_push_n(),
+     * emplace_back() and publish(), the consumer only calls empty(),
+     * front(), pop_front(), try_pop() and try_pop_n(). The read and write
+     * positions are kept in separate cache lines together with a cached copy
+     * of the other side's position, so the threads only share a cache line
+     * when the queue runs full or empty.
+     *
+     * \tparam  T   Type of values of this queue.
+     *
+     * \section spsc_queue_example Usage example
+     * \code{.cpp}
+     * esrlabs::estd::declare::spsc_queue<Sample, 256> samples;
+     *
+     * void acquisitionThread()
+     * {
+     *     if (!samples.full())
+     *     {
+     *         // construct the sample in place and hand it over
+     *         samples.emplace_back().construct(readAdc(), now());
+     *         samples.publish();
+     *     }
+     * }
+     *
+     * void processingThread()
+     * {
+     *     Sample buffer[16];
+     *     size_t const count = samples.try_pop_n(buffer, 16);
+     *     process(buffer, count);
+     * }
+     * \endcode
+     *
+     * \see esrlabs::estd::declare::spsc_queue
+     */
+    template<class T>
+    class spsc_queue
+    {
+        UNCOPYABLE(spsc_queue);
+
+    public:
+        /** The template parameter T */
+        typedef T              value_type;
+        /** A reference to the template parameter T */
+        typedef T&             reference;
+        /** A const reference to the template parameter T */
+        typedef const T&       const_reference;
+        /** A pointer to the template parameter T */
+        typedef T*             pointer;
+        /** A const pointer to the template parameter T */
+        typedef const T*       const_pointer;
+        /** An unsigned integral type for the size */
+        typedef std::size_t    size_type;
+
+        /**
+         * A simple destructor. This destructor does not call the contained
+         * object destructors. The derived class spsc_queue will call the
+         * destructors on any objects in the queue.
+         */
+        ~spsc_queue();
+
+        /**
+         * Returns maximum number of elements this queue can hold.
+         *
+         * \complexity Constant
+         */
+        size_type max_size() const;
+
+        /**
+         * Returns the number of elements in this queue. The value is only
+         * a snapshot if the other thread is working on the queue.
+         *
+         * \complexity Constant
+         */
+        size_type size() const;
+
+        /**
+         * Returns true if the queue has no elements. Consumer only.
+         *
+         * \complexity Constant
+         */
+        bool empty() const;
+
+        /**
+         * Returns true if no element can be added. Producer only.
+         *
+         * \complexity Constant
+         */
+        bool full() const;
+
+        /**
+         * Copies value into the queue. Producer only.
+         *
+         * \param value The value to copy into this queue.
+         * \return false if the queue is full.
+         * \complexity Constant
+         */
+        bool try_push(const_reference value);
+
+        /**
+         * Copies up to n values into the queue and makes them visible to the
+         * consumer at once. Producer only.
+         *
+         * \param values The values to copy into this queue.
+         * \param n The number of values.
+         * \return The number of values added.
+         * \complexity Linear in the number of values added.
+         */
+        size_type try_push_n(const_pointer values, size_type n);
+
+        /**
+         * Returns a constructor object to the next free slot of this queue.
+         * The constructed object is not visible to the consumer before
+         * publish() is called. Producer only.
+         *
+         * \return A constructor object that can be used to initialize an object.
+         * \assert{!full()}
+         */
+        constructor<T> emplace_back();
+
+        /**
+         * Makes the object created using emplace_back() visible to the consumer.
+         * Producer only.
+         */
+        void publish();
+
+        /**
+         * Returns a reference to the oldest element. Consumer only.
+         *
+         * \assert{!empty()}
+         */
+        reference front();
+
+        /**
+         * Removes the oldest element and destroys it. Consumer only.
+         *
+         * \assert{!empty()}
+         */
+        void pop_front();
+
+        /**
+         * Copies the oldest element into value and removes it from the queue.
+         * Consumer only.
+         *
+         * \param value The value receiving the element.
+         * \return false if the queue is empty.
+         */
+        bool try_pop(reference value);
+
+        /**
+         * Copies up to n of the oldest elements into values and removes them
+         * from the queue at once. Consumer only.
+         *
+         * \param values The array receiving the elements.
+         * \param n The size of the array.
+         * \return The number of elements removed.
+         */
+        size_type try_pop_n(pointer values, size_type n);
+
+    protected:
+
+        /**
+         * Constructor to initialize this queue with the actual data to work with.
+         * Used by the declare class. One slot of the data is always kept free.
+         *
+         * \param data The actual data for this queue
+         * \param size The size of the data array
+         */
+        spsc_queue(uint8_t data[], size_type size);
+
+        /**
+         * Destroys all elements. Must not be called concurrently.
+         */
+        void clear();
+
+    private:
+        T* slot(size_type index) const;
+
+        size_type next(size_type index) const;
+
+        size_type free_slots(size_type tail);
+
+        size_type used_slots(size_type head);
+
+        // shared, read only
+        uint8_t* _data;
+        size_type _slots;
+        char _pad0[ESTD_CACHE_LINE_SIZE];
+
+        // written by the producer
+        atomic<size_type> _tail;
+        size_type _cachedHead;
+        char _pad1[ESTD_CACHE_LINE_SIZE];
+
+        // written by the consumer
+        atomic<size_type> _head;
+        size_type _cachedTail;
+        char _pad2[ESTD_CACHE_LINE_SIZE];
+    };
+
+    /*
+     * namespace to declare a spsc_queue
+     */
+    namespace declare
+    {
+
+        /**
+         * Single producer, single consumer queue with static size.
+         *
+         * \tparam  T   Type of values of this queue.
+         * \tparam  N   Maximum number of values in this queue.
+         */
+        template<class T, std::size_t N>
+        class spsc_queue
+        :   public ::esrlabs::estd::spsc_queue<T>
+        {
+        public:
+            typedef ::esrlabs::estd::spsc_queue<T> base;
+
+            /**
+             * Constructs an empty queue.
+             */
+            spsc_queue();
+
+            /**
+             * Calls the destructor on all contained objects.
+             */
+            ~spsc_queue();
+
+        private:
+            typename aligned_storage<sizeof(T) * (N + 1), alignment_of<T>::value>::type _data;
+        };
+
+    } /* namespace declare */
+
+/*
+ *
+ * Implementation of spsc_queue
+ *
+ */
+
+template<class T>
+spsc_queue<T>::spsc_queue(uint8_t data[], size_type size)
+:   _data(data)
+,   _slots(size / sizeof(T))
+,   _tail(0)
+,   _cachedHead(0)
+,   _head(0)
+,   _cachedTail(0)
+{
+    estd_assert(_slots > 1);
+}
+
+template<class T>
+spsc_queue<T>::~spsc_queue()
+{
+
+}
+
+template<class T>inline
+T*
+spsc_queue<T>::slot(size_type index) const
+{
+    return reinterpret_cast<T*>(&_data[sizeof(T) * index]);
+}
+
+template<class T>inline
+typename spsc_queue<T>::size_type
+spsc_queue<T>::next(size_type index) const
+{
+    return (index + 1 == _slots) ? 0 : (index + 1);
+}
+
+template<class T>inline
+typename spsc_queue<T>::size_type
+spsc_queue<T>::free_slots(size_type tail)
+{
+    // one slot is kept free to distinguish a full from an empty queue
+    size_type count = (_cachedHead > tail) ? (_cachedHead - tail - 1) : (_slots - tail + _cachedHead - 1);
+    if (count == 0)
+    {
+        _cachedHead = _head.load(memory_order_acquire);
+        count = (_cachedHead > tail) ? (_cachedHead - tail - 1) : (_slots - tail + _cachedHead - 1);
+    }
+    return count;
+}
+
+template<class T>inline
+typename spsc_queue<T>::size_type
+spsc_queue<T>::used_slots(size_type head)
+{
+    size_type count = (_cachedTail >= head) ? (_cachedTail - head) : (_slots - head + _cachedTail);
+    if (count == 0)
+    {
+        _cachedTail = _tail.load(memory_order_acquire);
+        count = (_cachedTail >= head) ? (_cachedTail - head) : (_slots - head + _cachedTail);
+    }
+    return count;
+}
+
+template<class T>inline
+typename spsc_queue<T>::size_type
+spsc_queue<T>::max_size() const
+{
+    return _slots - 1;
+}
+
+template<class T>inline
+typename spsc_queue<T>::size_type
+spsc_queue<T>::size() const
+{
+    size_type const head = _head.load(memory_order_acquire);
+    size_type const tail = _tail.load(memory_order_acquire);
+    return (tail >= head) ? (tail - head) : (_slots - head + tail);
+}
+
+template<class T>inline
+bool
+spsc_queue<T>::empty() const
+{
+    return _head.load(memory_order_relaxed) == _tail.load(memory_order_acquire);
+}
+
+template<class T>inline
+bool
+spsc_queue<T>::full() const
+{
+    return next(_tail.load(memory_order_relaxed)) == _head.load(memory_order_acquire);
+}
+
+template<class T>
+bool
+spsc_queue<T>::try_push(const_reference value)
+{
+    size_type const tail = _tail.load(memory_order_relaxed);
+    if (free_slots(tail) == 0)
+    {
+        return false;
+    }
+    (void)new(slot(tail))T(value);
+    _tail.store(next(tail), memory_order_release);
+    return true;
+}
+
+template<class T>
+typename spsc_queue<T>::size_type
+spsc_queue<T>::try_push_n(const_pointer values, size_type n)
+{
+    size_type tail = _tail.load(memory_order_relaxed);
+    n = std::min(n, free_slots(tail));
+    for (size_type i = 0; i < n; ++i)
+    {
+        (void)new(slot(tail))T(values[i]);
+        tail = next(tail);
+    }
+    _tail.store(tail, memory_order_release);
+    return n;
+}
+
+template<class T>
+constructor<T>
+spsc_queue<T>::emplace_back()
+{
+    size_type const tail = _tail.load(memory_order_relaxed);
+    estd_assert(free_slots(tail) > 0);
+    return constructor<T>(reinterpret_cast<uint8_t*>(slot(tail)));
+}
+
+template<class T>inline
+void
+spsc_queue<T>::publish()
+{
+    _tail.store(next(_tail.load(memory_order_relaxed)), memory_order_release);
+}
+
+template<class T>
+typename spsc_queue<T>::reference
+spsc_queue<T>::front()
+{
+    size_type const head = _head.load(memory_order_relaxed);
+    estd_assert(used_slots(head) > 0);
+    return *slot(head);
+}
+
+template<class T>
+void
+spsc_queue<T>::pop_front()
+{
+    size_type const head = _head.load(memory_order_relaxed);
+    estd_assert(used_slots(head) > 0);
+    slot(head)->~T();
+    _head.store(next(head), memory_order_release);
+}
+
+template<class T>
+bool
+spsc_queue<T>::try_pop(reference value)
+{
+    size_type const head = _head.load(memory_order_relaxed);
+    if (used_slots(head) == 0)
+    {
+        return false;
+    }
+    T* const item = slot(head);
+    value = *item;
+    item->~T();
+    _head.store(next(head), memory_order_release);
+    return true;
+}
+
+template<class T>
+typename spsc_queue<T>::size_type
+spsc_queue<T>::try_pop_n(pointer values, size_type n)
+{
+    size_type head = _head.load(memory_order_relaxed);
+    n = std::min(n, used_slots(head));
+    for (size_type i = 0; i < n; ++i)
+    {
+        T* const item = slot(head);
+        values[i] = *item;
+        item->~T();
+        head = next(head);
+    }
+    _head.store(head, memory_order_release);
+    return n;
+}
+
+template<class T>
+void
+spsc_queue<T>::clear()
+{
+    size_type head = _head.load(memory_order_relaxed);
+    size_type const tail = _tail.load(memory_order_relaxed);
+    while (head != tail)
+    {
+        slot(head)->~T();
+        head = next(head);
+    }
+    _head.store(head, memory_order_relaxed);
+    _cachedTail = tail;
+}
+
+namespace declare
+{
+
+    template<class T, std::size_t N>
+    spsc_queue<T, N>::spsc_queue()
+    :   ::esrlabs::estd::spsc_queue<T>(_data.data, sizeof(T) * (N + 1))
+    ,   _data()
+    {}
+
+    template<class T, std::size_t N>
+    spsc_queue<T, N>::~spsc_queue()
+    {
+        base::clear();
+    }
+
+} /* namespace declare */
+
+} /* namespace estd */
+
+} /* namespace esrlabs */
+
+#endif
@@ -0,0 +1,978 @@
+/**
+ * Contains esrlabs::estd::string and esrlabs::estd::declare::string.
+ * \file
+ * \ingroup estl
+ * \copyright   E.S.R.Labs AG, 2014, All rights reserved.
+ */
+#ifndef ESTD_STRING_H
+#define ESTD_STRING_H
+
+#include <iterator>
+#include <limits>
+#include <estd/assert.h>
+#include <estd/estdint.h>
+
+namespace esrlabs {
+namespace estd {
+
+    namespace internal
+    {
+        /// \cond INTERNAL
+        /*
+         * Splits an integer into sign and magnitude.
+         */
+        template<class T, bool Signed = std::numeric_limits<T>::is_signed>
+        struct integer_parts
+        {
+            static bool negative(T value) { return value < 0; }
+
+            static uint64_t magnitude(T value)
+            {
+                // also right for the smallest value of T
+                return (value < 0) ? (0 - static_cast<uint64_t>(value)) : static_cast<uint64_t>(value);
+            }
+        };
+
+        template<class T>
+        struct integer_parts<T, false>
+        {
+            static bool negative(T) { return false; }
+
+            static uint64_t magnitude(T value) { return static_cast<uint64_t>(value); }
+        };
+        /// \endcond
+    } /* namespace internal */
+
+    /**
+     * A fixed-sized string of characters, which is always terminated by a
+     * null character.
+     *
+     * Appending text never fails: the append methods add as many
+     * characters as fit and drop the rest, which suits log lines and
+     * protocol text with a known upper bound. Integers are formatted
+     * directly into the string without snprintf, two digits at a time.
+     *
+     * \section string_example Usage example
+     * \code{.cpp}
+     * esrlabs::estd::declare::string<64> line;
+     * line.append("speed=").append_dec(speed).append(" flags=0x").append_hex(flags, 8);
+     * line.append(" temperature=").append_fixed(temperatureCentiDegrees, 2);
+     * log(line.c_str());
+     * \endcode
+     *
+     * \see esrlabs::estd::declare::string
+     */
+    class string
+    {
+    public:
+        /** The type of the characters */
+        typedef char           value_type;
+        /** A reference to a character */
+        typedef char&          reference;
+        /** A const reference to a character */
+        typedef const char&    const_reference;
+        /** A pointer to a character */
+        typedef char*          pointer;
+        /** A const pointer to a character */
+        typedef const char*    const_pointer;
+        /** An unsigned integral type for the size */
+        typedef std::size_t    size_type;
+        /** A signed integral type */
+        typedef std::ptrdiff_t difference_type;
+        /** A random access iterator */
+        typedef pointer        iterator;
+        /** A const random access iterator */
+        typedef const_pointer  const_iterator;
+        /** A random access reverse iterator */
+        typedef std::reverse_iterator<iterator> reverse_iterator;
+        /** A const random access reverse iterator */
+        typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+        /** The position returned by find if nothing has been found */
+        static const size_type npos = static_cast<size_type>(-1);
+
+        /**
+         * The maximum number of decimals of append_fixed.
+         */
+        static const size_type MAX_DECIMALS = 20;
+
+        /**
+         * Copies the characters of other into this string, as many as fit.
+         */
+        string& operator=(const string& other);
+
+        /**
+         * Copies the null terminated string s into this string, as many
+         * characters as fit.
+         */
+        string& operator=(const char* s);
+
+        /**
+         * Returns a reference to the character at position pos.
+         *
+         * \assert{pos < size()}
+         */
+        reference operator[](size_type pos);
+
+        /**
+         * Returns a const reference to the character at position pos.
+         *
+         * \assert{pos < size()}
+         */
+        const_reference operator[](size_type pos) const;
+
+        /**
+         * Returns a reference to the character at position pos.
+         *
+         * \assert{pos < size()}
+         */
+        reference at(size_type pos);
+
+        /**
+         * Returns a const reference to the character at position pos.
+         *
+         * \assert{pos < size()}
+         */
+        const_reference at(size_type pos) const;
+
+        /**
+         * Returns a reference to the first character.
+         *
+         * \assert{!empty()}
+         */
+        reference front();
+
+        /**
+         * Returns a const reference to the first character.
+         *
+         * \assert{!empty()}
+         */
+        const_reference front() const;
+
+        /**
+         * Returns a reference to the last character.
+         *
+         * \assert{!empty()}
+         */
+        reference back();
+
+        /**
+         * Returns a const reference to the last character.
+         *
+         * \assert{!empty()}
+         */
+        const_reference back() const;
+
+        /**
+         * Returns the characters as a null terminated string.
+         *
+         * \complexity Constant
+         */
+        const char* c_str() const;
+
+        /**
+         * Returns the characters, which are null terminated.
+         *
+         * \complexity Constant
+         */
+        const char* data() const;
+
+        /**
+         * Returns an iterator to the first character.
+         */
+        iterator begin();
+
+        /**
+         * Returns a const iterator to the first character.
+         */
+        const_iterator begin() const;
+
+        /**
+         * Returns a const iterator to the first character.
+         */
+        const_iterator cbegin() const;
+
+        /**
+         * Returns an iterator past the last character.
+         */
+        iterator end();
+
+        /**
+         * Returns a const iterator past the last character.
+         */
+        const_iterator end() const;
+
+        /**
+         * Returns a const iterator past the last character.
+         */
+        const_iterator cend() const;
+
+        /**
+         * Returns a reverse iterator to the last character.
+         */
+        reverse_iterator rbegin();
+
+        /**
+         * Returns a const reverse iterator to the last character.
+         */
+        const_reverse_iterator rbegin() const;
+
+        /**
+         * Returns a reverse iterator before the first character.
+         */
+        reverse_iterator rend();
+
+        /**
+         * Returns a const reverse iterator before the first character.
+         */
+        const_reverse_iterator rend() const;
+
+        /**
+         * Returns the number of characters.
+         *
+         * \complexity Constant
+         */
+        size_type size() const;
+
+        /**
+         * Returns the number of characters.
+         *
+         * \complexity Constant
+         */
+        size_type length() const;
+
+        /**
+         * Returns the maximum number of characters, not counting the
+         * terminating null character.
+         *
+         * \complexity Constant
+         */
+        size_type max_size() const;
+
+        /**
+         * Returns true if the string has no characters.
+         *
+         * \complexity Constant
+         */
+        bool empty() const;
+
+        /**
+         * Returns true if no more characters can be added.
+         *
+         * \complexity Constant
+         */
+        bool full() const;
+
+        /**
+         * Removes all characters.
+         *
+         * \complexity Constant
+         */
+        void clear();
+
+        /**
+         * Adds the character c to the end of this string.
+         *
+         * \assert{!full()}
+         */
+        void push_back(char c);
+
+        /**
+         * Removes the last character.
+         *
+         * \assert{!empty()}
+         */
+        void pop_back();
+
+        /**
+         * Replaces the characters with the null terminated string s.
+         */
+        string& assign(const char* s);
+
+        /**
+         * Replaces the characters with the n characters starting at s.
+         */
+        string& assign(const char* s, size_type n);
+
+        /**
+         * Replaces the characters with those of other.
+         */
+        string& assign(const string& other);
+
+        /**
+         * Replaces the characters with n copies of c.
+         */
+        string& assign(size_type n, char c);
+
+        /**
+         * Appends the null terminated string s, as many characters as fit.
+         *
+         * \complexity Linear in the number of characters appended.
+         */
+        string& append(const char* s);
+
+        /**
+         * Appends the n characters starting at s, as many as fit.
+         *
+         * \complexity Linear in the number of characters appended.
+         */
+        string& append(const char* s, size_type n);
+
+        /**
+         * Appends the characters of other, as many as fit.
+         *
+         * \complexity Linear in the number of characters appended.
+         */
+        string& append(const string& other);
+
+        /**
+         * Appends n copies of c, as many as fit.
+         *
+         * \complexity Linear in the number of characters appended.
+         */
+        string& append(size_type n, char c);
+
+        /**
+         * Appends the null terminated string s, as many characters as fit.
+         */
+        string& operator+=(const char* s);
+
+        /**
+         * Appends the characters of other, as many as fit.
+         */
+        string& operator+=(const string& other);
+
+        /**
+         * Appends the character c if it fits.
+         */
+        string& operator+=(char c);
+
+        /**
+         * Appends the decimal representation of the integer value, as many
+         * characters as fit.
+         *
+         * \complexity Linear in the number of digits.
+         */
+        template<class Integer>
+        string& append_dec(Integer value);
+
+        /**
+         * Appends the hexadecimal representation of the integer value with
+         * lower case digits and without prefix, as many characters as fit.
+         * Negative values are shown in two's complement of their type.
+         *
+         * \param value The integer to format.
+         * \param width The minimum number of digits, filled up with zeros.
+         * \complexity Linear in the number of digits.
+         */
+        template<class Integer>
+        string& append_hex(Integer value, size_type width = 0);
+
+        /**
+         * Appends a fixed point number, which is given as integer scaled
+         * by 10 to the power of decimals, e.g. 1234 with 2 decimals is
+         * appended as "12.34". Appends as many characters as fit.
+         *
+         * \param value The scaled integer to format.
+         * \param decimals The number of digits after the decimal point.
+         * \assert{decimals <= MAX_DECIMALS}
+         * \complexity Linear in the number of digits.
+         */
+        template<class Integer>
+        string& append_fixed(Integer value, size_type decimals);
+
+        /**
+         * Returns the position of the first character c at or after pos,
+         * or npos.
+         *
+         * \complexity Linear in size().
+         */
+        size_type find(char c, size_type pos = 0) const;
+
+        /**
+         * Returns the position of the first occurrence of the null
+         * terminated string s at or after pos, or npos.
+         *
+         * \complexity Linear in size() times the length of s.
+         */
+        size_type find(const char* s, size_type pos = 0) const;
+
+        /**
+         * Returns the position of the first occurrence of the n characters
+         * starting at s at or after pos, or npos.
+         *
+         * \complexity Linear in size() times n.
+         */
+        size_type find(const char* s, size_type pos, size_type n) const;
+
+        /**
+         * Returns the position of the first occurrence of other at or after
+         * pos, or npos.
+         *
+         * \complexity Linear in size() times other.size().
+         */
+        size_type find(const string& other, size_type pos = 0) const;
+
+        /**
+         * Returns the position of the last character c at or before pos,
+         * or npos.
+         *
+         * \complexity Linear in size().
+         */
+        size_type rfind(char c, size_type pos = npos) const;
+
+        /**
+         * Compares the characters with those of other lexicographically.
+         * Returns a negative value, zero or a positive value if this string
+         * is less than, equal to or greater than other.
+         *
+         * \complexity Linear in the size of the shorter string.
+         */
+        int compare(const string& other) const;
+
+        /**
+         * Compares the characters with the null terminated string s
+         * lexicographically.
+         *
+         * \complexity Linear in the size of the shorter string.
+         */
+        int compare(const char* s) const;
+
+        /**
+         * Compares the characters with the n characters starting at s
+         * lexicographically.
+         *
+         * \complexity Linear in the size of the shorter string.
+         */
+        int compare(const char* s, size_type n) const;
+
+    protected:
+        /**
+         * Constructor to initialize this string with the actual data to
+         * work with. Used by the declare class.
+         *
+         * \param data The storage for this string, capacity + 1 characters
+         * \param capacity The maximum number of characters
+         */
+        string(char data[], size_type capacity);
+
+    private:
+        string(const string& other);
+
+        string& append_decimal(uint64_t magnitude, bool negative);
+
+        string& append_hexadecimal(uint64_t value, size_type width);
+
+        string& append_fixed_point(uint64_t magnitude, bool negative, size_type decimals);
+
+        void terminate();
+
+        char* _data;
+        size_type _capacity;
+        size_type _size;
+    };
+
+    /**
+     * Returns true if both strings have the same characters.
+     */
+    bool operator==(const string& lhs, const string& rhs);
+
+    /**
+     * Returns true if the string has the characters of the null terminated
+     * string s.
+     */
+    bool operator==(const string& lhs, const char* rhs);
+
+    /**
+     * Returns true if the string has the characters of the null terminated
+     * string s.
+     */
+    bool operator==(const char* lhs, const string& rhs);
+
+    /**
+     * Returns true if the strings have different characters.
+     */
+    bool operator!=(const string& lhs, const string& rhs);
+
+    /**
+     * Returns true if the strings have different characters.
+     */
+    bool operator!=(const string& lhs, const char* rhs);
+
+    /**
+     * Returns true if the strings have different characters.
+     */
+    bool operator!=(const char* lhs, const string& rhs);
+
+    /**
+     * Returns true if lhs is lexicographically less than rhs.
+     */
+    bool operator<(const string& lhs, const string& rhs);
+
+    /**
+     * Returns true if lhs is lexicographically less than rhs.
+     */
+    bool operator<(const string& lhs, const char* rhs);
+
+    /**
+     * Returns true if lhs is lexicographically less than rhs.
+     */
+    bool operator<(const char* lhs, const string& rhs);
+
+    /*
+     * namespace to declare a string
+     */
+    namespace declare
+    {
+
+        /**
+         * String with static size.
+         *
+         * \tparam  N   Maximum number of characters of this string, not
+         *              counting the terminating null character.
+         */
+        template<std::size_t N>
+        class string
+        :   public ::esrlabs::estd::string
+        {
+        public:
+            typedef ::esrlabs::estd::string base;
+            typedef ::esrlabs::estd::declare::string<N> this_type;
+
+            /**
+             * Constructs an empty string.
+             */
+            string();
+
+            /**
+             * Constructs a string from the null terminated string s, as
+             * many characters as fit.
+             */
+            string(const char* s);
+
+            /**
+             * Copies the characters of the other string, as many as fit.
+             */
+            string(const base& other);
+
+            /**
+             * Copies the characters of the other string.
+             */
+            string(const this_type& other);
+
+            /**
+             * Copies the null terminated string s, as many characters as fit.
+             */
+            string& operator=(const char* s);
+
+            /**
+             * Copies the characters of the other string, as many as fit.
+             */
+            string& operator=(const base& other);
+
+            /**
+             * Copies the characters of the other string.
+             */
+            string& operator=(const this_type& other);
+
+        private:
+            char _data[N + 1];
+        };
+
+    } /* namespace declare */
+
+/*
+ *
+ * Implementation of string
+ *
+ */
+
+inline
+string&
+string::operator=(const string& other)
+{
+    return assign(other);
+}
+
+inline
+string&
+string::operator=(const char* s)
+{
+    return assign(s);
+}
+
+inline
+string::reference
+string::operator[](size_type pos)
+{
+    estd_assert(pos < _size);
+    return _data[pos];
+}
+
+inline
+string::const_reference
+string::operator[](size_type pos) const
+{
+    estd_assert(pos < _size);
+    return _data[pos];
+}
+
+inline
+string::reference
+string::at(size_type pos)
+{
+    estd_assert(pos < _size);
+    return _data[pos];
+}
+
+inline
+string::const_reference
+string::at(size_type pos) const
+{
+    estd_assert(pos < _size);
+    return _data[pos];
+}
+
+inline
+string::reference
+string::front()
+{
+    estd_assert(!empty());
+    return _data[0];
+}
+
+inline
+string::const_reference
+string::front() const
+{
+    estd_assert(!empty());
+    return _data[0];
+}
+
+inline
+string::reference
+string::back()
+{
+    estd_assert(!empty());
+    return _data[_size - 1];
+}
+
+inline
+string::const_reference
+string::back() const
+{
+    estd_assert(!empty());
+    return _data[_size - 1];
+}
+
+inline
+const char*
+string::c_str() const
+{
+    return _data;
+}
+
+inline
+const char*
+string::data() const
+{
+    return _data;
+}
+
+inline
+string::iterator
+string::begin()
+{
+    return _data;
+}
+
+inline
+string::const_iterator
+string::begin() const
+{
+    return _data;
+}
+
+inline
+string::const_iterator
+string::cbegin() const
+{
+    return _data;
+}
+
+inline
+string::iterator
+string::end()
+{
+    return _data + _size;
+}
+
+inline
+string::const_iterator
+string::end() const
+{
+    return _data + _size;
+}
+
+inline
+string::const_iterator
+string::cend() const
+{
+    return _data + _size;
+}
+
+inline
+string::reverse_iterator
+string::rbegin()
+{
+    return reverse_iterator(end());
+}
+
+inline
+string::const_reverse_iterator
+string::rbegin() const
+{
+    return const_reverse_iterator(end());
+}
+
+inline
+string::reverse_iterator
+string::rend()
+{
+    return reverse_iterator(begin());
+}
+
+inline
+string::const_reverse_iterator
+string::rend() const
+{
+    return const_reverse_iterator(begin());
+}
+
+inline
+string::size_type
+string::size() const
+{
+    return _size;
+}
+
+inline
+string::size_type
+string::length() const
+{
+    return _size;
+}
+
+inline
+string::size_type
+string::max_size() const
+{
+    return _capacity;
+}
+
+inline
+bool
+string::empty() const
+{
+    return _size == 0;
+}
+
+inline
+bool
+string::full() const
+{
+    return _size == _capacity;
+}
+
+inline
+void
+string::clear()
+{
+    _size = 0;
+    terminate();
+}
+
+inline
+void
+string::push_back(char c)
+{
+    estd_assert(!full());
+    _data[_size++] = c;
+    terminate();
+}
+
+inline
+void
+string::pop_back()
+{
+    estd_assert(!empty());
+    --_size;
+    terminate();
+}
+
+inline
+string&
+string::operator+=(const char* s)
+{
+    return append(s);
+}
+
+inline
+string&
+string::operator+=(const string& other)
+{
+    return append(other);
+}
+
+inline
+string&
+string::operator+=(char c)
+{
+    return append(1, c);
+}
+
+template<class Integer>inline
+string&
+string::append_dec(Integer value)
+{
+    return append_decimal(
+        internal::integer_parts<Integer>::magnitude(value),
+        internal::integer_parts<Integer>::negative(value));
+}
+
+template<class Integer>inline
+string&
+string::append_hex(Integer value, size_type width)
+{
+    // keeps the bits of the type only, negative values are sign extended
+    return append_hexadecimal(
+        static_cast<uint64_t>(value) & (static_cast<uint64_t>(-1) >> (64 - 8 * sizeof(Integer))),
+        width);
+}
+
+template<class Integer>inline
+string&
+string::append_fixed(Integer value, size_type decimals)
+{
+    return append_fixed_point(
+        internal::integer_parts<Integer>::magnitude(value),
+        internal::integer_parts<Integer>::negative(value),
+        decimals);
+}
+
+inline
+void
+string::terminate()
+{
+    _data[_size] = '\0';
+}
+
+inline
+bool
+operator!=(const string& lhs, const string& rhs)
+{
+    return !(lhs == rhs);
+}
+
+inline
+bool
+operator!=(const string& lhs, const char* rhs)
+{
+    return !(lhs == rhs);
+}
+
+inline
+bool
+operator!=(const char* lhs, const string& rhs)
+{
+    return !(rhs == lhs);
+}
+
+inline
+bool
+operator==(const char* lhs, const string& rhs)
+{
+    return rhs == lhs;
+}
+
+inline
+bool
+operator<(const string& lhs, const string& rhs)
+{
+    return lhs.compare(rhs) < 0;
+}
+
+inline
+bool
+operator<(const string& lhs, const char* rhs)
+{
+    return lhs.compare(rhs) < 0;
+}
+
+inline
+bool
+operator<(const char* lhs, const string& rhs)
+{
+    return rhs.compare(lhs) > 0;
+}
+
+namespace declare
+{
+
+    template<std::size_t N>
+    string<N>::string()
+    :   base(_data, N)
+    {}
+
+    template<std::size_t N>
+    string<N>::string(const char* s)
+    :   base(_data, N)
+    {
+        base::assign(s);
+    }
+
+    template<std::size_t N>
+    string<N>::string(const base& other)
+    :   base(_data, N)
+    {
+        base::assign(other);
+    }
+
+    template<std::size_t N>
+    string<N>::string(const this_type& other)
+    :   base(_data, N)
+    {
+        base::assign(other);
+    }
+
+    template<std::size_t N>
+    string<N>&
+    string<N>::operator=(const char* s)
+    {
+        base::assign(s);
+        return *this;
+    }
+
+    template<std::size_t N>
+    string<N>&
+    string<N>::operator=(const base& other)
+    {
+        base::assign(other);
+        return *this;
+    }
+
+    template<std::size_t N>
+    string<N>&
+    string<N>::operator=(const this_type& other)
+    {
+        base::assign(other);
+        return *this;
+    }
+
+} /* namespace declare */
+
+} /* namespace estd */
+
+} /* namespace esrlabs */
+
+#endif /* ESTD_STRING_H */
@@ -0,0 +1,413 @@
+/**
+ * Contains esrlabs::estd::timer_wheel and esrlabs::estd::declare::timer_wheel.
+ * \file
+ * \ingroup estl
+ * \copyright   E.S.R.Labs AG, 2014, All rights reserved.
+ */
+#ifndef ESTD_TIMER_WHEEL_H
+#define ESTD_TIMER_WHEEL_H
+
+#include <estd/assert.h>
+#include <estd/bitset.h>
+#include <estd/estdint.h>
+#include <estd/intrusive_list.h>
+#include <estd/object_pool.h>
+#include <estd/uncopyable.h>
+
+namespace esrlabs {
+namespace estd {
+
+    namespace internal
+    {
+        /// \cond INTERNAL
+        template<std::size_t N>
+        struct log2
+        {
+            static const std::size_t value = 1 + log2<N / 2>::value;
+        };
+
+        template<>
+        struct log2<1>
+        {
+            static const std::size_t value = 0;
+        };
+        /// \endcond
+    } /* namespace internal */
+
+    /**
+     * A fixed-sized set of timers on hierarchical timing wheels, for many
+     * timeouts that are started, restarted and stopped far more often than
+     * they expire.
+     *
+     * Time is counted in ticks of the caller's choice. The wheels have a
+     * number of slots each, the first wheel one tick per slot, the next
+     * wheel as many ticks per slot as the first wheel has slots, and so on,
+     * until the wheels cover the range of tick_type. A timer is put into
+     * the slot of the wheel that matches its remaining time, and the
+     * timers of a slot of an upper wheel are distributed to the lower
+     * wheels when its time has come.
+     *
+     * start(), stop() and restart() take constant time. advance() jumps
+     * over the ticks without timers with the help of a bit per slot, so it
+     * takes time linear in the number of expired timers and the slots on
+     * the way that hold timers, but not in the number of elapsed ticks.
+     * Every timer is cascaded at most once per wheel.
+     *
+     * Timers are identified by the handles returned from start(), which
+     * are valid until the timer is stopped or has expired.
+     *
+     * \section timer_wheel_example Usage example
+     * \code{.cpp}
+     * esrlabs::estd::declare::timer_wheel<256, 1024> timeouts;
+     *
+     * void send(Request& request)
+     * {
+     *     request.timer = timeouts.start(RESPONSE_TIMEOUT, &request);
+     * }
+     *
+     * void receive(Request& request)
+     * {
+     *     timeouts.stop(request.timer);
+     * }
+     *
+     * struct Timeout
+     * {
+     *     void operator()(std::size_t, void* context) const
+     *     {
+     *         retry(*static_cast<Request*>(context));
+     *     }
+     * };
+     *
+     * void tick(uint32_t now)
+     * {
+     *     timeouts.advance(now, Timeout());
+     * }
+     * \endcode
+     *
+     * \see esrlabs::estd::declare::timer_wheel
+     */
+    class timer_wheel
+    {
+        UNCOPYABLE(timer_wheel);
+
+    public:
+        /** The type of points in time and delays, in ticks */
+        typedef uint32_t    tick_type;
+        /** An unsigned integral type for the size and the handles */
+        typedef std::size_t size_type;
+
+        /** The longest delay of a timer */
+        static const tick_type MAX_DELAY = 0x7FFFFFFFU;
+
+        /**
+         * Returns the number of running timers.
+         *
+         * \complexity Constant
+         */
+        size_type size() const;
+
+        /**
+         * Returns the maximum number of running timers.
+         *
+         * \complexity Constant
+         */
+        size_type max_size() const;
+
+        /**
+         * Returns true if no timer is running.
+         *
+         * \complexity Constant
+         */
+        bool empty() const;
+
+        /**
+         * Returns true if no more timers can be started.
+         *
+         * \complexity Constant
+         */
+        bool full() const;
+
+        /**
+         * Returns the current time, which is the time given to the last
+         * call of advance().
+         */
+        tick_type now() const;
+
+        /**
+         * Starts a timer expiring delay ticks from now(). A delay of 0
+         * expires with the next tick.
+         *
+         * \param delay The number of ticks until the timer expires.
+         * \param context Passed to the function called on expiry.
+         * \return The handle of the timer.
+         * \assert{!full()}
+         * \assert{delay <= MAX_DELAY}
+         * \complexity Constant
+         */
+        size_type start(tick_type delay, void* context = 0L);
+
+        /**
+         * Stops a running timer, the handle is invalid afterwards.
+         *
+         * \assert{timer is a valid handle}
+         * \complexity Constant
+         */
+        void stop(size_type timer);
+
+        /**
+         * Restarts a timer to expire delay ticks from now(). A timer may be
+         * restarted while its expiry is being handled, which keeps it
+         * running.
+         *
+         * \assert{timer is a valid handle}
+         * \assert{delay <= MAX_DELAY}
+         * \complexity Constant
+         */
+        void restart(size_type timer, tick_type delay);
+
+        /**
+         * Returns the context the timer has been started with.
+         *
+         * \assert{timer is a valid handle}
+         */
+        void* context(size_type timer) const;
+
+        /**
+         * Advances the time to now and calls f(timer, context) for each
+         * timer that expires on the way, tick by tick. f may start, stop
+         * and restart timers. An expired timer is stopped after f returns
+         * unless f has restarted it.
+         *
+         * \param now The new time, at most MAX_DELAY ticks after now().
+         * \param f A function object called for each expired timer.
+         * \return The number of expired timers.
+         * \complexity Linear in the expired timers and the occupied slots
+         *             on the way.
+         */
+        template<class Function>
+        size_type advance(tick_type now, Function f);
+
+        /**
+         * Stops all timers.
+         *
+         * \complexity Linear in max_size() and the number of slots.
+         */
+        void clear();
+
+    protected:
+        /// \cond INTERNAL
+        struct timer
+        :   public intrusive_list_hook<>
+        {
+            tick_type expires;
+            // index of the slot holding the timer, or EXPIRING
+            uint32_t list;
+            void* context;
+        };
+
+        typedef intrusive_list<timer> timer_list;
+        /// \endcond
+
+        /**
+         * Constructor to initialize this wheel with the actual data to work
+         * with. Used by the declare class.
+         *
+         * \param timers The pool of timers
+         * \param slots The lists of the slots of all wheels
+         * \param used A bit per slot, set while the slot holds timers
+         * \param slotBits The binary logarithm of the number of slots per wheel
+         * \param now The initial time
+         */
+        timer_wheel(
+            object_pool<timer>& timers,
+            timer_list slots[],
+            bitset_view& used,
+            size_type slotBits,
+            tick_type now);
+
+        ~timer_wheel();
+
+    private:
+        static const uint32_t EXPIRING = 0xFFFFFFFFU;
+
+        void place(timer& t);
+
+        void unlink(timer& t);
+
+        timer_list& take(size_type index);
+
+        tick_type ticks_to_next_slot() const;
+
+        void cascade(tick_type tick);
+
+        void collect();
+
+        void finish(size_type timer);
+
+        object_pool<timer>& _timers;
+        timer_list* _slots;
+        bitset_view& _used;
+        timer_list _expiring;
+        size_type _bits;
+        size_type _wheels;
+        tick_type _mask;
+        // the tick advance() handles next
+        tick_type _next;
+    };
+
+    /*
+     * namespace to declare a timer wheel
+     */
+    namespace declare
+    {
+
+        /**
+         * Timer wheel with static size.
+         *
+         * \tparam  Slots   Number of slots per wheel, a power of two. More
+         *                  slots need more memory and cascade less often.
+         * \tparam  Timers  Maximum number of running timers.
+         */
+        template<std::size_t Slots, std::size_t Timers>
+        class timer_wheel
+        :   public ::esrlabs::estd::timer_wheel
+        {
+        public:
+            typedef ::esrlabs::estd::timer_wheel base;
+
+            /** The binary logarithm of Slots */
+            static const size_type SLOT_BITS = internal::log2<Slots>::value;
+
+            /** The number of wheels covering the range of tick_type */
+            static const size_type WHEELS = (32 + SLOT_BITS - 1) / SLOT_BITS;
+
+            /**
+             * Constructs a wheel without timers.
+             *
+             * \param now The initial time.
+             */
+            explicit timer_wheel(tick_type now = 0);
+
+            /**
+             * Stops all timers.
+             */
+            ~timer_wheel();
+
+        private:
+            typedef char slots_have_to_be_a_power_of_2[
+                ((Slots >= 2) && ((Slots & (Slots - 1)) == 0)) ? 1 : -1];
+
+            declare::object_pool<timer, Timers> _pool;
+            timer_list _lists[WHEELS * Slots];
+            declare::bitset<WHEELS * Slots> _used;
+        };
+
+    } /* namespace declare */
+
+/*
+ *
+ * Implementation of timer_wheel
+ *
+ */
+
+inline
+timer_wheel::size_type
+timer_wheel::size() const
+{
+    return _timers.size();
+}
+
+inline
+timer_wheel::size_type
+timer_wheel::max_size() const
+{
+    return _timers.max_size();
+}
+
+inline
+bool
+timer_wheel::empty() const
+{
+    return _timers.empty();
+}
+
+inline
+bool
+timer_wheel::full() const
+{
+    return _timers.full();
+}
+
+inline
+timer_wheel::tick_type
+timer_wheel::now() const
+{
+    return _next - 1U;
+}
+
+inline
+void*
+timer_wheel::context(size_type timer) const
+{
+    return _timers.at(timer).context;
+}
+
+template<class Function>
+timer_wheel::size_type
+timer_wheel::advance(tick_type now, Function f)
+{
+    estd_assert(static_cast<tick_type>(now - this->now()) <= MAX_DELAY);
+    size_type expired = 0;
+    for (;;)
+    {
+        tick_type const remaining = now - _next;
+        if (remaining > MAX_DELAY)
+        {
+            // all ticks up to now have been handled
+            break;
+        }
+        tick_type const skip = ticks_to_next_slot();
+        if (skip > remaining)
+        {
+            _next = now + 1U;
+            break;
+        }
+        _next += skip;
+        collect();
+        while (!_expiring.empty())
+        {
+            timer& t = _expiring.front();
+            _expiring.pop_front();
+            size_type const handle = _timers.index_of(&t);
+            f(handle, t.context);
+            finish(handle);
+            ++expired;
+        }
+    }
+    return expired;
+}
+
+namespace declare
+{
+
+    template<std::size_t Slots, std::size_t Timers>
+    timer_wheel<Slots, Timers>::timer_wheel(tick_type now)
+    :   base(_pool, _lists, _used, SLOT_BITS, now)
+    ,   _pool()
+    ,   _used()
+    {}
+
+    template<std::size_t Slots, std::size_t Timers>
+    timer_wheel<Slots, Timers>::~timer_wheel()
+    {
+        // unlinks the timers before the lists and the pool are destroyed
+        base::clear();
+    }
+
+} /* namespace declare */
+
+} /* namespace estd */
+
+} /* namespace esrlabs */
+
+#endif /* ESTD_TIMER_WHEEL_H */
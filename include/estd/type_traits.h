@@ -7,6 +7,7 @@
 #ifndef ESTD_TYPE_TRAITS_H
 #define ESTD_TYPE_TRAITS_H
 
+#include <cstddef>
 #include <estd/estdint.h>
 
 namespace esrlabs {
@@ -54,6 +55,12 @@ namespace estd {
     template<class T> struct remove_cv
     { typedef typename remove_const<typename remove_volatile<T>::type>::type type; };
     
+    template<class T> struct remove_pointer                     { typedef T type; };
+    template<class T> struct remove_pointer<T*>                 { typedef T type; };
+    template<class T> struct remove_pointer<T* const>           { typedef T type; };
+    template<class T> struct remove_pointer<T* volatile>        { typedef T type; };
+    template<class T> struct remove_pointer<T* const volatile>  { typedef T type; };
+    
     template<class T> struct is_void : public false_type {};
     template<> struct is_void<void>  : public true_type {};
     
@@ -145,6 +152,160 @@ namespace estd {
     template<> struct is_integral<uint32_t> : true_type {};
     template<> struct is_integral<uint64_t> : true_type {};
 
+    template<class T> struct is_floating_point : false_type {};
+    template<> struct is_floating_point<float> : true_type {};
+    template<> struct is_floating_point<double> : true_type {};
+    template<> struct is_floating_point<long double> : true_type {};
+
+    template<class T> struct is_arithmetic
+    : public integral_constant<bool, is_integral<T>::value || is_floating_point<T>::value> {};
+
+#ifdef ESTD_IS_ENUM
+    template<class T> struct is_enum : public integral_constant<bool, ESTD_IS_ENUM(T)> {};
+#else
+    template<class T> struct is_enum : public false_type {};
+#endif
+
+    template<class T> struct is_scalar
+    : public integral_constant<bool, is_arithmetic<T>::value || is_enum<T>::value || is_pointer<T>::value> {};
+
+    /**
+     * Determines whether T is a plain old data type.
+     *
+     * Uses the compiler intrinsic if the compiler configuration provides
+     * ESTD_IS_POD, otherwise only scalar types and arrays of them are detected.
+     * Specialize this template to declare a type as POD explicitly:
+     * \code{.cpp}
+     * namespace esrlabs { namespace estd {
+     *     template<> struct is_pod<Frame> : public true_type {};
+     * } }
+     * \endcode
+     */
+#ifdef ESTD_IS_POD
+    template<class T> struct is_pod : public integral_constant<bool, ESTD_IS_POD(T)> {};
+#else
+    template<class T> struct is_pod : public is_scalar<typename remove_cv<T>::type> {};
+    template<class T, size_t N> struct is_pod<T[N]> : public is_pod<T> {};
+#endif
+
+    /**
+     * Determines whether objects of type T can be copied with memcpy and
+     * do not need to be destroyed.
+     *
+     * Every type declared as POD by is_pod is trivially copyable as well.
+     * Containers use this trait to replace element-wise copies by memcpy
+     * and memset.
+     */
+#ifdef ESTD_IS_TRIVIALLY_COPYABLE
+    template<class T> struct is_trivially_copyable
+    : public integral_constant<bool, ESTD_IS_TRIVIALLY_COPYABLE(T) || is_pod<T>::value> {};
+#else
+    template<class T> struct is_trivially_copyable : public integral_constant<bool, is_pod<T>::value> {};
+#endif
+
+    /**
+     * Determines whether an object of type T can be moved to another address
+     * with memmove without calling its constructors and destructor.
+     *
+     * By default this holds for trivially copyable types only. Classes with
+     * user provided copy or move operations that do not store pointers or
+     * references to themselves may opt in by specializing this template:
+     * \code{.cpp}
+     * namespace esrlabs { namespace estd {
+     *     template<> struct is_trivially_relocatable<Message> : public true_type {};
+     * } }
+     * \endcode
+     * Types that need to know their own address, e.g. values linked into an
+     * intrusive_list, must never opt in. Containers move elements that are
+     * not trivially relocatable by copy or move constructing them at the new
+     * address and destroying the old object.
+     */
+    template<class T> struct is_trivially_relocatable
+    : public integral_constant<bool, is_trivially_copyable<T>::value> {};
+
+    namespace internal
+    {
+        /// \cond INTERNAL
+        template<class T> struct _alignment_of_helper { char _c; T _t; };
+
+        union _max_align
+        {
+            long double _ld;
+            double _d;
+            long _l;
+            void* _p;
+            void (*_f)();
+        };
+        /// \endcond
+    } /* namespace internal */
+
+    /**
+     * Provides the alignment requirement of type T in bytes.
+     */
+#ifdef ESTD_ALIGNOF
+    template<class T> struct alignment_of
+    : public integral_constant<size_t, ESTD_ALIGNOF(T)> {};
+#else
+    template<class T> struct alignment_of
+    : public integral_constant<size_t, sizeof(internal::_alignment_of_helper<T>) - sizeof(T)> {};
+#endif
+
+    namespace internal
+    {
+        /// \cond INTERNAL
+#ifdef ESTD_ALIGNED
+        template<size_t Align> struct _aligned_type
+        {
+            struct type { uint8_t _ ESTD_ALIGNED(Align); };
+        };
+#else
+        template<size_t Align> struct _aligned_type
+        {
+            typedef _max_align type;
+        };
+#endif
+        /// \endcond
+    } /* namespace internal */
+
+    /**
+     * Provides a POD type with an alignment requirement of Align bytes.
+     *
+     * The fundamental types are tried first. Alignments that are larger
+     * than the alignment of any fundamental type, e.g. cache line alignment,
+     * require ESTD_ALIGNED to be provided by the compiler configuration.
+     * Otherwise the strictest fundamental alignment is used.
+     */
+    template<size_t Align>
+    struct type_with_alignment
+    {
+        typedef typename conditional<alignment_of<char>::value == Align, char,
+                typename conditional<alignment_of<short>::value == Align, short,
+                typename conditional<alignment_of<int>::value == Align, int,
+                typename conditional<alignment_of<long>::value == Align, long,
+                typename conditional<alignment_of<double>::value == Align, double,
+                typename conditional<alignment_of<long double>::value == Align, long double,
+                typename internal::_aligned_type<Align>::type
+                >::type>::type>::type>::type>::type>::type type;
+    };
+
+    /**
+     * Provides a POD type that is suitable as raw storage for objects of
+     * size Len with an alignment requirement of Align bytes.
+     *
+     * \tparam Len     The size of the storage in bytes.
+     * \tparam Align   The alignment of the storage, defaults to the strictest
+     *                 alignment of any fundamental type.
+     */
+    template<size_t Len, size_t Align = alignment_of<internal::_max_align>::value>
+    struct aligned_storage
+    {
+        union type
+        {
+            uint8_t data[Len];
+            typename type_with_alignment<Align>::type align;
+        };
+    };
+
 } /* namespace estd */
 
 } /* namespace esrlabs */
@@ -0,0 +1,945 @@
+/**
+ * Contains esrlabs::estd::unordered_map and esrlabs::estd::declare::unordered_map.
+ * \file
+ * \ingroup estl
+ * \copyright   E.S.R.Labs AG, 2014, All rights reserved.
+ */
+#ifndef ESTD_UNORDERED_MAP_H
+#define ESTD_UNORDERED_MAP_H
+
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <new>
+#include <utility>
+#include <estd/assert.h>
+#include <estd/constructor.h>
+#include <estd/hash.h>
+#include <estd/type_traits.h>
+#include <estd/vector.h>
+
+namespace esrlabs {
+namespace estd {
+
+    namespace internal
+    {
+        /// \cond INTERNAL
+        template<class Map, class Reference, class Pointer>
+        class unordered_map_iterator;
+
+        template<std::size_t X, std::size_t P = 1, bool Done = (P >= X)>
+        struct _next_power_of_two
+        :   _next_power_of_two<X, P * 2> {};
+
+        template<std::size_t X, std::size_t P>
+        struct _next_power_of_two<X, P, true>
+        :   integral_constant<std::size_t, P> {};
+        /// \endcond
+    } /* namespace internal */
+
+    /**
+     * A fixed-sized hash map using open addressing with Robin Hood hashing.
+     *
+     * The keys are stored in a power of two number of buckets. An additional
+     * byte per bucket stores how far the element is away from its home
+     * bucket. On insertion, elements which are far away from their home
+     * bucket take precedence over elements close to their home bucket, which
+     * keeps probe sequences short and lets unsuccessful lookups stop early.
+     * Erasing shifts the following elements back, so no tombstones are
+     * needed and the map does not degrade over time.
+     *
+     * Inserting invalidates all iterators. Erasing invalidates iterators to
+     * the erased element and to the elements following it in the same
+     * cluster, erase(const_iterator) returns a valid iterator to continue
+     * iterating.
+     *
+     * \tparam  Key         Type of the keys.
+     * \tparam  T           Type of the mapped values.
+     * \tparam  Hash        Function object calculating the hash of a key.
+     * \tparam  KeyEqual    Function object comparing two keys.
+     *
+     * \section unordered_map_example Usage example
+     * \code{.cpp}
+     * esrlabs::estd::declare::unordered_map<uint32_t, Handler*, 64> handlers;
+     *
+     * void onMessage(uint32_t id, const uint8_t* payload)
+     * {
+     *     esrlabs::estd::unordered_map<uint32_t, Handler*>::iterator i = handlers.find(id);
+     *     if (i != handlers.end())
+     *     {
+     *         i->second->handle(payload);
+     *     }
+     * }
+     * \endcode
+     *
+     * \see esrlabs::estd::declare::unordered_map
+     */
+    template<
+        class Key,
+        class T,
+        class Hash = hash<Key>,
+        class KeyEqual = std::equal_to<Key> >
+    class unordered_map
+    {
+    public:
+        /** The type of the keys */
+        typedef Key                               key_type;
+        /** The type of the mapped values */
+        typedef T                                 mapped_type;
+        /** The type of the elements */
+        typedef std::pair<const Key, T>           value_type;
+        /** A reference to an element */
+        typedef value_type&                       reference;
+        /** A const reference to an element */
+        typedef const value_type&                 const_reference;
+        /** A pointer to an element */
+        typedef value_type*                       pointer;
+        /** A const pointer to an element */
+        typedef const value_type*                 const_pointer;
+        /** An unsigned integral type for the size */
+        typedef std::size_t                       size_type;
+        /** A signed integral type */
+        typedef std::ptrdiff_t                    difference_type;
+        /** The function object calculating the hash of a key */
+        typedef Hash                              hasher;
+        /** The function object comparing two keys */
+        typedef KeyEqual                          key_equal;
+        /** A forward iterator */
+        typedef internal::unordered_map_iterator<
+            unordered_map, reference, pointer>    iterator;
+        /** A const forward iterator */
+        typedef internal::unordered_map_iterator<
+            const unordered_map, const_reference, const_pointer> const_iterator;
+
+        /**
+         * A simple destructor. This destructor does not call the contained
+         * object destructors. The derived class unordered_map will call the
+         * destructors on any objects in the map.
+         */
+        ~unordered_map();
+
+        /**
+         * Copies the elements of the other map into this map.
+         *
+         * \assert{other.size() <= max_size()}
+         */
+        unordered_map& operator=(const unordered_map& other);
+
+        /**
+         * Returns the number of elements in this map.
+         *
+         * \complexity Constant
+         */
+        size_type size() const;
+
+        /**
+         * Returns maximum number of elements this map can hold.
+         *
+         * \complexity Constant
+         */
+        size_type max_size() const;
+
+        /**
+         * Returns the number of buckets of this map.
+         *
+         * \complexity Constant
+         */
+        size_type bucket_count() const;
+
+        /**
+         * Returns true if the map has no elements.
+         *
+         * \complexity Constant
+         */
+        bool empty() const;
+
+        /**
+         * Returns true if no more elements can be inserted.
+         *
+         * \complexity Constant
+         */
+        bool full() const;
+
+        /**
+         * Returns an iterator to the element with the given key or end().
+         *
+         * \complexity Constant on average.
+         */
+        iterator find(const key_type& key);
+
+        /**
+         * Returns an iterator to the element with the given key or end().
+         *
+         * \complexity Constant on average.
+         */
+        const_iterator find(const key_type& key) const;
+
+        /**
+         * Returns the number of elements with the given key, 0 or 1.
+         *
+         * \complexity Constant on average.
+         */
+        size_type count(const key_type& key) const;
+
+        /**
+         * Returns a reference to the value mapped to the given key.
+         *
+         * \assert{count(key) == 1}
+         */
+        mapped_type& at(const key_type& key);
+
+        /**
+         * Returns a reference to the value mapped to the given key.
+         *
+         * \assert{count(key) == 1}
+         */
+        const mapped_type& at(const key_type& key) const;
+
+        /**
+         * Returns a reference to the value mapped to the given key. A default
+         * constructed value is inserted if the key is not in the map.
+         *
+         * \assert{count(key) == 1 || !full()}
+         */
+        mapped_type& operator[](const key_type& key);
+
+        /**
+         * Inserts a copy of value if its key is not in the map.
+         *
+         * \return An iterator to the element with the key of value and true
+         * if value has been inserted.
+         * \assert{count(value.first) == 1 || !full()}
+         */
+        std::pair<iterator, bool> insert(const_reference value);
+
+        /**
+         * Returns a constructor object for the value mapped to the given key.
+         * The key is inserted if it is not in the map, otherwise the current
+         * value is destroyed. The value has to be constructed before the
+         * map is used again.
+         *
+         * \code{.cpp}
+         * handlers.emplace(id).construct(callback, context);
+         * \endcode
+         *
+         * \return A constructor object that can be used to initialize the value.
+         * \assert{count(key) == 1 || !full()}
+         */
+        constructor<mapped_type> emplace(const key_type& key);
+
+        /**
+         * Removes the element with the given key.
+         *
+         * \return The number of removed elements, 0 or 1.
+         * \complexity Constant on average.
+         */
+        size_type erase(const key_type& key);
+
+        /**
+         * Removes the element at position.
+         *
+         * \return An iterator to the element following the removed one.
+         * \complexity Constant on average.
+         */
+        iterator erase(const_iterator position);
+
+        /**
+         * Removes all elements.
+         *
+         * \complexity Linear in the number of buckets.
+         */
+        void clear();
+
+        /** An iterator to the first element. */
+        iterator begin();
+
+        /** A const iterator to the first element. */
+        const_iterator begin() const;
+
+        /** A const iterator to the first element. */
+        const_iterator cbegin() const;
+
+        /** An iterator to the element following the last one. */
+        iterator end();
+
+        /** A const iterator to the element following the last one. */
+        const_iterator end() const;
+
+        /** A const iterator to the element following the last one. */
+        const_iterator cend() const;
+
+    protected:
+        /**
+         * Constructor to initialize this map with the actual data to work with.
+         * Used by the declare class.
+         *
+         * \param data The actual data for this map, buckets elements followed
+         * by buckets bytes
+         * \param buckets The number of buckets, a power of two
+         * \param maxSize The maximum number of elements, less than buckets
+         */
+        unordered_map(uint8_t data[], size_type buckets, size_type maxSize);
+
+    private:
+        template<class, class, class> friend class internal::unordered_map_iterator;
+
+        unordered_map(const unordered_map& other);
+
+        // the distance byte of an empty bucket, occupied buckets store the
+        // distance to the home bucket plus one
+        static const uint8_t EMPTY = 0;
+        static const uint8_t MAX_DISTANCE = 255;
+
+        pointer slot(size_type index) const;
+
+        bool occupied(size_type index) const;
+
+        size_type next(size_type index) const;
+
+        size_type prev(size_type index) const;
+
+        size_type home(const key_type& key) const;
+
+        size_type lookup(const key_type& key) const;
+
+        size_type make_room(const key_type& key);
+
+        void erase_at(size_type index);
+
+        void relocate_buckets(size_type dst, size_type src, size_type n);
+
+        void shift_up(size_type first, size_type last);
+
+        void shift_down(size_type first, size_type last);
+
+        void update_head();
+
+        uint8_t* _data;
+        uint8_t* _distances;
+        size_type _mask;
+        size_type _shift;
+        size_type _max_size;
+        size_type _size;
+        // bucket where iteration starts, no element is shifted across it
+        size_type _head;
+        hasher _hash;
+        key_equal _equal;
+    };
+
+    namespace internal
+    {
+        /// \cond INTERNAL
+        /*
+         * Forward iterator over the buckets of an unordered_map. Iteration
+         * starts at the head bucket of the map and wraps around.
+         */
+        template<class Map, class Reference, class Pointer>
+        class unordered_map_iterator
+        {
+        public:
+            typedef std::forward_iterator_tag       iterator_category;
+            typedef typename Map::value_type        value_type;
+            typedef std::ptrdiff_t                  difference_type;
+            typedef Pointer                         pointer;
+            typedef Reference                       reference;
+
+            unordered_map_iterator() : _map(0L), _offset(0) {}
+
+            unordered_map_iterator(Map* m, std::size_t offset) : _map(m), _offset(offset)
+            {
+                skip();
+            }
+
+            // conversion from iterator to const_iterator
+            template<class M, class R, class P>
+            unordered_map_iterator(const unordered_map_iterator<M, R, P>& other)
+            :   _map(other._map)
+            ,   _offset(other._offset)
+            {}
+
+            reference operator*() const { return *_map->slot(index()); }
+            pointer operator->() const { return _map->slot(index()); }
+
+            unordered_map_iterator& operator++() { ++_offset; skip(); return *this; }
+            unordered_map_iterator operator++(int) { unordered_map_iterator tmp(*this); ++(*this); return tmp; }
+
+            template<class M, class R, class P>
+            bool operator==(const unordered_map_iterator<M, R, P>& other) const { return _offset == other._offset; }
+            template<class M, class R, class P>
+            bool operator!=(const unordered_map_iterator<M, R, P>& other) const { return _offset != other._offset; }
+
+            std::size_t index() const { return (_map->_head + _offset) & _map->_mask; }
+
+        private:
+            template<class, class, class> friend class unordered_map_iterator;
+
+            void skip()
+            {
+                while ((_offset <= _map->_mask) && !_map->occupied(index()))
+                {
+                    ++_offset;
+                }
+            }
+
+            Map* _map;
+            std::size_t _offset;
+        };
+        /// \endcond
+    } /* namespace internal */
+
+    /*
+     * namespace to declare an unordered_map
+     */
+    namespace declare
+    {
+
+        /**
+         * Hash map with static size. The number of buckets is the next power
+         * of two providing at least an eighth of N as free buckets.
+         *
+         * \tparam  Key         Type of the keys.
+         * \tparam  T           Type of the mapped values.
+         * \tparam  N           Maximum number of elements in this map.
+         * \tparam  Hash        Function object calculating the hash of a key.
+         * \tparam  KeyEqual    Function object comparing two keys.
+         */
+        template<
+            class Key,
+            class T,
+            std::size_t N,
+            class Hash = hash<Key>,
+            class KeyEqual = std::equal_to<Key> >
+        class unordered_map
+        :   public ::esrlabs::estd::unordered_map<Key, T, Hash, KeyEqual>
+        {
+        public:
+            typedef ::esrlabs::estd::unordered_map<Key, T, Hash, KeyEqual> base;
+            typedef ::esrlabs::estd::declare::unordered_map<Key, T, N, Hash, KeyEqual> this_type;
+
+            /** The number of buckets */
+            static const std::size_t BUCKETS =
+                internal::_next_power_of_two<N + N / 8 + 1>::value;
+
+            /**
+             * Constructs an empty map.
+             */
+            unordered_map();
+
+            /**
+             * Copies the elements of the other map into this map.
+             */
+            unordered_map(const base& other);
+
+            /**
+             * Copies the elements of the other map into this map.
+             */
+            unordered_map(const this_type& other);
+
+            /**
+             * Calls the destructor on all contained objects.
+             */
+            ~unordered_map();
+
+            /**
+             * Copies the elements of the other map into this map.
+             */
+            unordered_map& operator=(const base& other);
+
+            /**
+             * Copies the elements of the other map into this map.
+             */
+            unordered_map& operator=(const this_type& other);
+
+        private:
+            typedef typename base::value_type value_type;
+
+            typename aligned_storage<
+                (sizeof(value_type) + 1) * BUCKETS,
+                alignment_of<value_type>::value>::type _data;
+        };
+
+    } /* namespace declare */
+
+/*
+ *
+ * Implementation of unordered_map
+ *
+ */
+
+template<class K, class T, class H, class E>
+unordered_map<K, T, H, E>::unordered_map(uint8_t data[], size_type buckets, size_type maxSize)
+:   _data(data)
+,   _distances(data + sizeof(value_type) * buckets)
+,   _mask(buckets - 1)
+,   _shift(sizeof(size_type) * 8)
+,   _max_size(maxSize)
+,   _size(0)
+,   _head(0)
+,   _hash()
+,   _equal()
+{
+    estd_assert((buckets > 1) && ((buckets & _mask) == 0) && (maxSize < buckets));
+    for (size_type b = buckets; b > 1; b >>= 1)
+    {
+        --_shift;
+    }
+    (void)memset(_distances, EMPTY, buckets);
+}
+
+template<class K, class T, class H, class E>
+unordered_map<K, T, H, E>::~unordered_map()
+{
+
+}
+
+template<class K, class T, class H, class E>
+unordered_map<K, T, H, E>&
+unordered_map<K, T, H, E>::operator=(const unordered_map& other)
+{
+    if (this != &other)
+    {
+        estd_assert(other.size() <= max_size());
+        clear();
+        for (const_iterator i = other.begin(); i != other.end(); ++i)
+        {
+            (void)new(slot(make_room(i->first)))value_type(*i);
+        }
+    }
+    return *this;
+}
+
+template<class K, class T, class H, class E>inline
+typename unordered_map<K, T, H, E>::pointer
+unordered_map<K, T, H, E>::slot(size_type index) const
+{
+    return reinterpret_cast<pointer>(&_data[sizeof(value_type) * index]);
+}
+
+template<class K, class T, class H, class E>inline
+bool
+unordered_map<K, T, H, E>::occupied(size_type index) const
+{
+    return _distances[index] != EMPTY;
+}
+
+template<class K, class T, class H, class E>inline
+typename unordered_map<K, T, H, E>::size_type
+unordered_map<K, T, H, E>::next(size_type index) const
+{
+    return (index + 1) & _mask;
+}
+
+template<class K, class T, class H, class E>inline
+typename unordered_map<K, T, H, E>::size_type
+unordered_map<K, T, H, E>::prev(size_type index) const
+{
+    return (index - 1) & _mask;
+}
+
+template<class K, class T, class H, class E>inline
+typename unordered_map<K, T, H, E>::size_type
+unordered_map<K, T, H, E>::home(const key_type& key) const
+{
+    // Fibonacci hashing spreads consecutive keys over all buckets and uses
+    // the well mixed upper bits of the product
+    static const size_type GOLDEN_RATIO = (sizeof(size_type) > 4)
+        ? (((static_cast<size_type>(0x9E3779B9UL) << 16) << 16) | 0x7F4A7C15UL)
+        : static_cast<size_type>(0x9E3779B9UL);
+    return (static_cast<size_type>(_hash(key)) * GOLDEN_RATIO) >> _shift;
+}
+
+template<class K, class T, class H, class E>
+typename unordered_map<K, T, H, E>::size_type
+unordered_map<K, T, H, E>::lookup(const key_type& key) const
+{
+    size_type index = home(key);
+    for (unsigned int distance = 1; _distances[index] >= distance; ++distance)
+    {
+        // an element closer to its home bucket ends the search, the key
+        // would have taken its place
+        if ((_distances[index] == distance) && _equal(slot(index)->first, key))
+        {
+            return index;
+        }
+        index = next(index);
+    }
+    return _mask + 1;
+}
+
+/*
+ * Makes room for the given key, which must not be in the map yet, and
+ * returns the bucket to construct it into.
+ */
+template<class K, class T, class H, class E>
+typename unordered_map<K, T, H, E>::size_type
+unordered_map<K, T, H, E>::make_room(const key_type& key)
+{
+    estd_assert(!full());
+    size_type index = home(key);
+    unsigned int distance = 1;
+    while (_distances[index] >= distance)
+    {
+        estd_assert(distance < MAX_DISTANCE);
+        ++distance;
+        index = next(index);
+    }
+    size_type last = index;
+    while (occupied(last))
+    {
+        last = next(last);
+    }
+    shift_up(index, last);
+    _distances[index] = static_cast<uint8_t>(distance);
+    ++_size;
+    update_head();
+    return index;
+}
+
+template<class K, class T, class H, class E>inline
+void
+unordered_map<K, T, H, E>::relocate_buckets(size_type dst, size_type src, size_type n)
+{
+    if (n > 0)
+    {
+        relocate(slot(dst), slot(src), n);
+    }
+}
+
+/*
+ * Moves the elements in [first, last) one bucket up, last must be empty.
+ */
+template<class K, class T, class H, class E>
+void
+unordered_map<K, T, H, E>::shift_up(size_type first, size_type last)
+{
+    if (first <= last)
+    {
+        relocate_buckets(first + 1, first, last - first);
+    }
+    else
+    {
+        relocate_buckets(1, 0, last);
+        relocate_buckets(0, _mask, 1);
+        relocate_buckets(first + 1, first, _mask - first);
+    }
+    for (size_type i = last; i != first; i = prev(i))
+    {
+        estd_assert(_distances[prev(i)] < MAX_DISTANCE);
+        _distances[i] = static_cast<uint8_t>(_distances[prev(i)] + 1);
+    }
+}
+
+/*
+ * Moves the elements in (first, last) one bucket down, first must have
+ * been destroyed.
+ */
+template<class K, class T, class H, class E>
+void
+unordered_map<K, T, H, E>::shift_down(size_type first, size_type last)
+{
+    if (first < last)
+    {
+        relocate_buckets(first, first + 1, last - first - 1);
+    }
+    else
+    {
+        relocate_buckets(first, first + 1, _mask - first);
+        if (last > 0)
+        {
+            relocate_buckets(_mask, 0, 1);
+            relocate_buckets(0, 1, last - 1);
+        }
+    }
+    size_type i = first;
+    for (; next(i) != last; i = next(i))
+    {
+        _distances[i] = static_cast<uint8_t>(_distances[next(i)] - 1);
+    }
+    _distances[i] = EMPTY;
+}
+
+template<class K, class T, class H, class E>
+void
+unordered_map<K, T, H, E>::erase_at(size_type index)
+{
+    slot(index)->~value_type();
+    // shift back all following elements which are not in their home bucket
+    size_type last = next(index);
+    while (_distances[last] > 1)
+    {
+        last = next(last);
+    }
+    shift_down(index, last);
+    --_size;
+}
+
+/*
+ * Keeps the head on a bucket which is empty or holds an element in its
+ * home bucket. Erasing never shifts an element across such a bucket,
+ * so iterating and erasing visits every element exactly once.
+ */
+template<class K, class T, class H, class E>inline
+void
+unordered_map<K, T, H, E>::update_head()
+{
+    while (_distances[_head] > 1)
+    {
+        _head = next(_head);
+    }
+}
+
+template<class K, class T, class H, class E>inline
+typename unordered_map<K, T, H, E>::size_type
+unordered_map<K, T, H, E>::size() const
+{
+    return _size;
+}
+
+template<class K, class T, class H, class E>inline
+typename unordered_map<K, T, H, E>::size_type
+unordered_map<K, T, H, E>::max_size() const
+{
+    return _max_size;
+}
+
+template<class K, class T, class H, class E>inline
+typename unordered_map<K, T, H, E>::size_type
+unordered_map<K, T, H, E>::bucket_count() const
+{
+    return _mask + 1;
+}
+
+template<class K, class T, class H, class E>inline
+bool
+unordered_map<K, T, H, E>::empty() const
+{
+    return _size == 0;
+}
+
+template<class K, class T, class H, class E>inline
+bool
+unordered_map<K, T, H, E>::full() const
+{
+    return _size == _max_size;
+}
+
+template<class K, class T, class H, class E>inline
+typename unordered_map<K, T, H, E>::iterator
+unordered_map<K, T, H, E>::find(const key_type& key)
+{
+    size_type const index = lookup(key);
+    return (index > _mask) ? end() : iterator(this, (index - _head) & _mask);
+}
+
+template<class K, class T, class H, class E>inline
+typename unordered_map<K, T, H, E>::const_iterator
+unordered_map<K, T, H, E>::find(const key_type& key) const
+{
+    size_type const index = lookup(key);
+    return (index > _mask) ? end() : const_iterator(this, (index - _head) & _mask);
+}
+
+template<class K, class T, class H, class E>inline
+typename unordered_map<K, T, H, E>::size_type
+unordered_map<K, T, H, E>::count(const key_type& key) const
+{
+    return (lookup(key) > _mask) ? 0 : 1;
+}
+
+template<class K, class T, class H, class E>inline
+typename unordered_map<K, T, H, E>::mapped_type&
+unordered_map<K, T, H, E>::at(const key_type& key)
+{
+    size_type const index = lookup(key);
+    estd_assert(index <= _mask);
+    return slot(index)->second;
+}
+
+template<class K, class T, class H, class E>inline
+const typename unordered_map<K, T, H, E>::mapped_type&
+unordered_map<K, T, H, E>::at(const key_type& key) const
+{
+    size_type const index = lookup(key);
+    estd_assert(index <= _mask);
+    return slot(index)->second;
+}
+
+template<class K, class T, class H, class E>
+typename unordered_map<K, T, H, E>::mapped_type&
+unordered_map<K, T, H, E>::operator[](const key_type& key)
+{
+    size_type index = lookup(key);
+    if (index > _mask)
+    {
+        index = make_room(key);
+        (void)new(slot(index))value_type(key, mapped_type());
+    }
+    return slot(index)->second;
+}
+
+template<class K, class T, class H, class E>
+std::pair<typename unordered_map<K, T, H, E>::iterator, bool>
+unordered_map<K, T, H, E>::insert(const_reference value)
+{
+    size_type index = lookup(value.first);
+    bool const inserted = (index > _mask);
+    if (inserted)
+    {
+        index = make_room(value.first);
+        (void)new(slot(index))value_type(value);
+    }
+    return std::make_pair(iterator(this, (index - _head) & _mask), inserted);
+}
+
+template<class K, class T, class H, class E>
+constructor<typename unordered_map<K, T, H, E>::mapped_type>
+unordered_map<K, T, H, E>::emplace(const key_type& key)
+{
+    size_type index = lookup(key);
+    if (index > _mask)
+    {
+        index = make_room(key);
+        (void)new(const_cast<key_type*>(&slot(index)->first))key_type(key);
+    }
+    else
+    {
+        slot(index)->second.~mapped_type();
+    }
+    return constructor<mapped_type>(reinterpret_cast<uint8_t*>(&slot(index)->second));
+}
+
+template<class K, class T, class H, class E>
+typename unordered_map<K, T, H, E>::size_type
+unordered_map<K, T, H, E>::erase(const key_type& key)
+{
+    size_type const index = lookup(key);
+    if (index > _mask)
+    {
+        return 0;
+    }
+    erase_at(index);
+    return 1;
+}
+
+template<class K, class T, class H, class E>
+typename unordered_map<K, T, H, E>::iterator
+unordered_map<K, T, H, E>::erase(const_iterator position)
+{
+    size_type const offset = (position.index() - _head) & _mask;
+    erase_at(position.index());
+    // the bucket now holds the next element if one has been shifted back
+    return iterator(this, offset);
+}
+
+template<class K, class T, class H, class E>
+void
+unordered_map<K, T, H, E>::clear()
+{
+    for (size_type i = 0; i <= _mask; ++i)
+    {
+        if (occupied(i))
+        {
+            slot(i)->~value_type();
+        }
+    }
+    (void)memset(_distances, EMPTY, _mask + 1);
+    _size = 0;
+    _head = 0;
+}
+
+template<class K, class T, class H, class E>inline
+typename unordered_map<K, T, H, E>::iterator
+unordered_map<K, T, H, E>::begin()
+{
+    return iterator(this, 0);
+}
+
+template<class K, class T, class H, class E>inline
+typename unordered_map<K, T, H, E>::const_iterator
+unordered_map<K, T, H, E>::begin() const
+{
+    return const_iterator(this, 0);
+}
+
+template<class K, class T, class H, class E>inline
+typename unordered_map<K, T, H, E>::const_iterator
+unordered_map<K, T, H, E>::cbegin() const
+{
+    return begin();
+}
+
+template<class K, class T, class H, class E>inline
+typename unordered_map<K, T, H, E>::iterator
+unordered_map<K, T, H, E>::end()
+{
+    return iterator(this, _mask + 1);
+}
+
+template<class K, class T, class H, class E>inline
+typename unordered_map<K, T, H, E>::const_iterator
+unordered_map<K, T, H, E>::end() const
+{
+    return const_iterator(this, _mask + 1);
+}
+
+template<class K, class T, class H, class E>inline
+typename unordered_map<K, T, H, E>::const_iterator
+unordered_map<K, T, H, E>::cend() const
+{
+    return end();
+}
+
+namespace declare
+{
+
+    template<class K, class T, std::size_t N, class H, class E>
+    const std::size_t unordered_map<K, T, N, H, E>::BUCKETS;
+
+    template<class K, class T, std::size_t N, class H, class E>
+    unordered_map<K, T, N, H, E>::unordered_map()
+    :   base(_data.data, BUCKETS, N)
+    {}
+
+    template<class K, class T, std::size_t N, class H, class E>
+    unordered_map<K, T, N, H, E>::unordered_map(const base& other)
+    :   base(_data.data, BUCKETS, N)
+    {
+        base::operator=(other);
+    }
+
+    template<class K, class T, std::size_t N, class H, class E>
+    unordered_map<K, T, N, H, E>::unordered_map(const this_type& other)
+    :   base(_data.data, BUCKETS, N)
+    {
+        base::operator=(other);
+    }
+
+    template<class K, class T, std::size_t N, class H, class E>
+    unordered_map<K, T, N, H, E>::~unordered_map()
+    {
+        base::clear();
+    }
+
+    template<class K, class T, std::size_t N, class H, class E>
+    unordered_map<K, T, N, H, E>&
+    unordered_map<K, T, N, H, E>::operator=(const base& other)
+    {
+        base::operator=(other);
+        return *this;
+    }
+
+    template<class K, class T, std::size_t N, class H, class E>
+    unordered_map<K, T, N, H, E>&
+    unordered_map<K, T, N, H, E>::operator=(const this_type& other)
+    {
+        base::operator=(other);
+        return *this;
+    }
+
+} /* namespace declare */
+
+} /* namespace estd */
+
+} /* namespace esrlabs */
+
+#endif
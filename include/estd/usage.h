@@ -0,0 +1,261 @@
+/**
+ * Contains esrlabs::estd::container_usage, the optional instrumentation
+ * measuring how much of their capacity containers actually use.
+ * \file
+ * \ingroup estl
+ * \copyright   E.S.R.Labs AG, 2014, All rights reserved.
+ *
+ * Defining ESTL_TRACK_USAGE for the whole program, including the library,
+ * adds a container_usage to every vector and deque. It records the peak
+ * size, how often an insertion has filled the container and the number of
+ * inserted and erased elements. All instances are registered in a static
+ * list, which dump_usage() prints as a report of capacity and peak bytes
+ * to size declare::vector<T, N> and declare::deque<T, N> from real runs.
+ *
+ * Without ESTL_TRACK_USAGE the containers have neither an additional
+ * member nor additional code.
+ */
+#ifndef ESTD_USAGE_H
+#define ESTD_USAGE_H
+
+#if defined(ESTL_TRACK_USAGE)
+
+#include <cstdio>
+#include <estd/estdint.h>
+#include <estd/uncopyable.h>
+
+#  define estd_track_insert(U__, SIZE__, N__) ((U__).inserted((SIZE__), (N__)))
+#  define estd_track_erase(U__, N__) ((U__).erased(N__))
+
+namespace esrlabs {
+namespace estd {
+
+    /**
+     * The usage of a single container instance. Constructing an instance
+     * registers it, destroying it removes it from the registry.
+     *
+     * \note
+     * The registry is not synchronized. Containers have to be constructed
+     * and destroyed by one thread at a time, the counters of a container
+     * are updated by the thread modifying it.
+     */
+    class container_usage
+    {
+        UNCOPYABLE(container_usage);
+
+    public:
+        /** An unsigned integral type for sizes and counters */
+        typedef std::size_t size_type;
+
+        /**
+         * Registers the usage of a container.
+         *
+         * \param kind The kind of container, e.g. "vector".
+         * \param elementSize The size of an element in bytes.
+         * \param capacity The maximum number of elements.
+         */
+        container_usage(const char* kind, size_type elementSize, size_type capacity);
+
+        /**
+         * Removes the usage from the registry.
+         */
+        ~container_usage();
+
+        /**
+         * Returns the first registered usage, or 0L if there is none.
+         */
+        static const container_usage* first();
+
+        /**
+         * Returns the next registered usage, or 0L if this is the last one.
+         */
+        const container_usage* next() const;
+
+        /**
+         * Sets a name identifying the container in the report. The string
+         * is not copied and has to outlive the container.
+         */
+        void set_name(const char* name);
+
+        /**
+         * Returns the name of the container, or 0L if it has none.
+         */
+        const char* name() const;
+
+        /** Returns the kind of container given to the constructor. */
+        const char* kind() const;
+
+        /** Returns the size of an element in bytes. */
+        size_type element_size() const;
+
+        /** Returns the maximum number of elements. */
+        size_type capacity() const;
+
+        /** Returns the largest number of elements the container held. */
+        size_type peak() const;
+
+        /** Returns how often an insertion has left the container full. */
+        size_type full_hits() const;
+
+        /** Returns the number of inserted elements. */
+        size_type inserts() const;
+
+        /** Returns the number of erased elements. */
+        size_type erases() const;
+
+        /** Returns capacity() * element_size(). */
+        size_type capacity_bytes() const;
+
+        /** Returns peak() * element_size(). */
+        size_type peak_bytes() const;
+
+        /// \cond INTERNAL
+        void inserted(size_type size, size_type n);
+
+        void erased(size_type n);
+        /// \endcond
+
+    private:
+        container_usage* _previous;
+        container_usage* _next;
+        const char* _kind;
+        const char* _name;
+        size_type _element_size;
+        size_type _capacity;
+        size_type _peak;
+        size_type _full_hits;
+        size_type _inserts;
+        size_type _erases;
+    };
+
+    /**
+     * Prints a line per registered container to out, with its capacity and
+     * peak in elements and bytes, the full hits, inserts and erases, and
+     * the totals of the capacity and peak bytes.
+     */
+    void dump_usage(std::FILE* out);
+
+/*
+ *
+ * Implementation of container_usage
+ *
+ */
+
+inline
+const container_usage*
+container_usage::next() const
+{
+    return _next;
+}
+
+inline
+void
+container_usage::set_name(const char* name)
+{
+    _name = name;
+}
+
+inline
+const char*
+container_usage::name() const
+{
+    return _name;
+}
+
+inline
+const char*
+container_usage::kind() const
+{
+    return _kind;
+}
+
+inline
+container_usage::size_type
+container_usage::element_size() const
+{
+    return _element_size;
+}
+
+inline
+container_usage::size_type
+container_usage::capacity() const
+{
+    return _capacity;
+}
+
+inline
+container_usage::size_type
+container_usage::peak() const
+{
+    return _peak;
+}
+
+inline
+container_usage::size_type
+container_usage::full_hits() const
+{
+    return _full_hits;
+}
+
+inline
+container_usage::size_type
+container_usage::inserts() const
+{
+    return _inserts;
+}
+
+inline
+container_usage::size_type
+container_usage::erases() const
+{
+    return _erases;
+}
+
+inline
+container_usage::size_type
+container_usage::capacity_bytes() const
+{
+    return _capacity * _element_size;
+}
+
+inline
+container_usage::size_type
+container_usage::peak_bytes() const
+{
+    return _peak * _element_size;
+}
+
+inline
+void
+container_usage::inserted(size_type size, size_type n)
+{
+    _inserts += n;
+    if (size > _peak)
+    {
+        _peak = size;
+    }
+    if ((n > 0) && (size == _capacity))
+    {
+        ++_full_hits;
+    }
+}
+
+inline
+void
+container_usage::erased(size_type n)
+{
+    _erases += n;
+}
+
+} /* namespace estd */
+
+} /* namespace esrlabs */
+
+#else
+
+#  define estd_track_insert(U__, SIZE__, N__) ((void)0)
+#  define estd_track_erase(U__, N__) ((void)0)
+
+#endif /* ESTL_TRACK_USAGE */
+
+#endif /* ESTD_USAGE_H */
@@ -11,14 +11,32 @@
 #include <iterator>
 #include <new>
 #include <cstring>
+#include <utility>
 #include <estd/nullptr.h>
 #include <estd/assert.h>
 #include <estd/type_traits.h>
 #include <estd/constructor.h>
+#include <estd/usage.h>
 
 namespace esrlabs {
 namespace estd {
 
+    /**
+     * Moves n objects starting at src to the raw memory starting at dst.
+     * The source and destination ranges may overlap. After the call the
+     * objects live at dst and the memory at src that is not part of the
+     * destination range is raw memory.
+     *
+     * Trivially relocatable types, by default the trivially copyable ones,
+     * are moved with a single memmove, all other types are move (or copy)
+     * constructed at the destination and destroyed at the source one by
+     * one.
+     *
+     * \see esrlabs::estd::is_trivially_relocatable
+     */
+    template<class T>
+    void relocate(T* dst, T* src, std::size_t n);
+
     /**
      * A fixed-sized STL like vector.
      *
@@ -57,6 +75,11 @@ namespace estd {
      *     d.emplace_back().construct(1, 2, 3);
      * }\endcode
      *
+     * Elements are shifted in memory by insert, emplace and erase. Only
+     * trivially copyable types are shifted with memmove by default, other
+     * types that tolerate it may opt in by specializing
+     * esrlabs::estd::is_trivially_relocatable.
+     *
      * \see esrlabs::estd::declare::vector
      * \see esrlabs::estd::constructor
      */
@@ -100,9 +123,27 @@ namespace estd {
          *
          * \param other The other vector to copy.
          * \return A reference to this.
+         * \note
+         * If T is trivially copyable, all values are copied with a single memcpy.
          */
         vector<T>& operator=(const vector<T>& other);
 
+#if __cplusplus >= 201103L
+        /**
+         * A move assignment operator. Replaces all values in this vector by
+         * the values of other, which are relocated into this vector. other
+         * is empty afterwards.
+         *
+         * \param other The other vector to move from.
+         * \return A reference to this.
+         * \assert{other.size() <= max_size()}
+         * \complexity Linear in size() and other.size().
+         * \note
+         * If T is trivially relocatable, all values are moved with a single memmove.
+         */
+        vector<T>& operator=(vector<T>&& other);
+#endif
+
         /**
          * Replaces any element currently in this container and fills it with n
          * elements which all are initialized with a copy of value. Existing
@@ -114,6 +155,7 @@ namespace estd {
          *
          * \note
          * If n > max_size(), only max_size() elements will be added.
+         * If T is trivially copyable, the elements are filled using memset or memcpy.
          */
         void assign(size_type n, const_reference value);
 
@@ -260,6 +302,17 @@ namespace estd {
          */
         void push_back(const_reference value);
 
+#if __cplusplus >= 201103L
+        /**
+         * Move constructs an element at the end of this vector from a
+         * given value increasing this vector's size by one.
+         *
+         * \param value The value to move into this vector.
+         * \assert{!full()}
+         */
+        void push_back(value_type&& value);
+#endif
+
         /**
          * Returns a constructor object to the memory allocated at the end
          * of this vector increasing this vectors size by one.
@@ -290,6 +343,13 @@ namespace estd {
          */
         iterator insert(const_iterator position, const_reference value);
 
+#if __cplusplus >= 201103L
+        /**
+         *  Moves given value into the vector before the specified iterator.
+         */
+        iterator insert(const_iterator position, value_type&& value);
+#endif
+
         /**
          *  Inserts n copies of given value into the vector before the specified iterator.
          */
@@ -297,6 +357,13 @@ namespace estd {
 
         /**
          *  Inserts copies of the elements in the range [first,last) at position.
+         *  Returns an iterator pointing to the first inserted element.
+         *
+         *  \complexity Linear in the number of elements inserted plus the
+         *  number of elements after position for forward iterators.
+         *  \note
+         *  If the range does not fit into the vector, only the first
+         *  max_size() - size() elements of the range are inserted.
          */
         template<class InputIterator>
         typename enable_if
@@ -376,10 +443,32 @@ namespace estd {
         const_reverse_iterator crend() const;
 
         /**
-         * Swaps this vector with another given vector.
+         * Exchanges the values of this vector with the values of other. Both
+         * vectors keep their storage, the values are swapped element by
+         * element and the surplus values of the larger vector are relocated
+         * into the smaller one.
+         *
+         * \assert{size() <= other.max_size()}
+         * \assert{other.size() <= max_size()}
+         * \complexity Linear in the larger size of both vectors.
+         * \note
+         * If T is trivially relocatable, the values are swapped with memcpy
+         * in blocks of bytes.
          */
         void swap(vector& other);
 
+#if defined(ESTL_TRACK_USAGE)
+        /**
+         * Returns the usage statistics of this vector.
+         */
+        container_usage& usage();
+
+        /**
+         * Returns the usage statistics of this vector.
+         */
+        const container_usage& usage() const;
+#endif
+
     protected:
 
         /**
@@ -399,6 +488,17 @@ namespace estd {
         uint8_t* _data;
         size_type _max_size;
         size_type _size;
+#if defined(ESTL_TRACK_USAGE)
+        container_usage _usage;
+#endif
+
+        void assign_from(const vector<T>& other, true_type);
+
+        void assign_from(const vector<T>& other, false_type);
+
+        void fill(iterator position, size_type n, const_reference value, true_type);
+
+        void fill(iterator position, size_type n, const_reference value, false_type);
 
         template<class InputIterator>
         void range_insert(
@@ -413,6 +513,12 @@ namespace estd {
             ForwardIterator first,
             ForwardIterator last,
             std::forward_iterator_tag);
+
+        template<class ForwardIterator>
+        void copy_construct(iterator position, ForwardIterator first, size_type n, true_type);
+
+        template<class ForwardIterator>
+        void copy_construct(iterator position, ForwardIterator first, size_type n, false_type);
     };
 
     /**
@@ -528,16 +634,28 @@ namespace estd {
 
         /**
          * STL like vector with static size.
-         * \tparam  T   Type of values of this vector.
-         * \tparam  N   Maximum number of values in this vector.
+         *
+         * The storage is aligned for objects of type T. A stricter alignment
+         * can be requested, e.g. to place each vector in its own cache lines
+         * and avoid false sharing between vectors used by different cores:
+         * \code{.cpp}
+         * esrlabs::estd::declare::vector<Sample, 128, ESTD_CACHE_LINE_SIZE> samples;
+         * \endcode
+         *
+         * \tparam  T           Type of values of this vector.
+         * \tparam  N           Maximum number of values in this vector.
+         * \tparam  Alignment   Alignment of the storage in bytes, defaults to
+         *                      the alignment of T. It has to be a power of two
+         *                      not less than the alignment of T, which is
+         *                      checked at compile time.
          */
-        template<class T, std::size_t N>
+        template<class T, std::size_t N, std::size_t Alignment = alignment_of<T>::value>
         class vector
         :   public ::esrlabs::estd::vector<T>
         {
         public:
             typedef ::esrlabs::estd::vector<T> base;
-            typedef ::esrlabs::estd::declare::vector<T, N> this_type;
+            typedef ::esrlabs::estd::declare::vector<T, N, Alignment> this_type;
 
             /** The template parameter T */
             typedef typename base::value_type      value_type;
@@ -582,6 +700,20 @@ namespace estd {
              */
             vector(const this_type& other);
 
+#if __cplusplus >= 201103L
+            /**
+             * Relocates the values of the other vector into this vector,
+             * other is empty afterwards.
+             */
+            vector(base&& other);
+
+            /**
+             * Relocates the values of the other vector into this vector,
+             * other is empty afterwards.
+             */
+            vector(this_type&& other);
+#endif
+
             /**
              * Calls the destructor on all contained objects.
              */
@@ -597,8 +729,27 @@ namespace estd {
              */
             vector& operator=(const this_type& other);
 
+#if __cplusplus >= 201103L
+            /**
+             * Relocates the values of the other vector into this vector,
+             * other is empty afterwards.
+             */
+            vector& operator=(base&& other);
+
+            /**
+             * Relocates the values of the other vector into this vector,
+             * other is empty afterwards.
+             */
+            vector& operator=(this_type&& other);
+#endif
+
         private:
-            uint8_t _data[sizeof(T) * N];
+            typedef char alignment_has_to_be_a_power_of_2[
+                ((Alignment > 0) && ((Alignment & (Alignment - 1)) == 0)) ? 1 : -1];
+            typedef char alignment_must_not_be_weaker_than_the_one_of_T[
+                (Alignment >= alignment_of<T>::value) ? 1 : -1];
+
+            typename aligned_storage<sizeof(T) * N, Alignment>::type _data;
         };
 
     } /* namespace declare */
@@ -658,6 +809,94 @@ operator<=(const vector<T>& x, const vector<T>& y)
     return !(x > y);
 }
 
+/*
+ *
+ * Implementation of relocate
+ *
+ */
+
+namespace internal
+{
+/// \cond INTERNAL
+
+template<class T>inline
+void
+relocate(T* dst, T* src, std::size_t n, true_type)
+{
+    memmove(static_cast<void*>(dst), static_cast<const void*>(src), sizeof(T) * n);
+}
+
+template<class T>
+void
+relocate(T* dst, T* src, std::size_t n, false_type)
+{
+    if (dst < src)
+    {
+        for (std::size_t i = 0; i < n; ++i)
+        {
+#if __cplusplus >= 201103L
+            (void)new(dst + i)T(std::move(src[i]));
+#else
+            (void)new(dst + i)T(src[i]);
+#endif
+            src[i].~T();
+        }
+    }
+    else if (dst > src)
+    {
+        for (std::size_t i = n; i > 0; --i)
+        {
+#if __cplusplus >= 201103L
+            (void)new(dst + i - 1)T(std::move(src[i - 1]));
+#else
+            (void)new(dst + i - 1)T(src[i - 1]);
+#endif
+            src[i - 1].~T();
+        }
+    }
+}
+
+template<class T>
+void
+swap_elements(T* a, T* b, std::size_t n, true_type)
+{
+    // swaps the raw bytes through a small buffer, which is valid for
+    // trivially relocatable types
+    uint8_t buffer[128];
+    uint8_t* x = reinterpret_cast<uint8_t*>(a);
+    uint8_t* y = reinterpret_cast<uint8_t*>(b);
+    std::size_t bytes = sizeof(T) * n;
+    // whole blocks have a constant size the compiler can inline
+    for (; bytes >= sizeof(buffer); bytes -= sizeof(buffer))
+    {
+        memcpy(buffer, x, sizeof(buffer));
+        memcpy(x, y, sizeof(buffer));
+        memcpy(y, buffer, sizeof(buffer));
+        x += sizeof(buffer);
+        y += sizeof(buffer);
+    }
+    memcpy(buffer, x, bytes);
+    memcpy(x, y, bytes);
+    memcpy(y, buffer, bytes);
+}
+
+template<class T>inline
+void
+swap_elements(T* a, T* b, std::size_t n, false_type)
+{
+    std::swap_ranges(a, a + n, b);
+}
+
+/// \endcond
+} /* namespace internal */
+
+template<class T>inline
+void
+relocate(T* dst, T* src, std::size_t n)
+{
+    internal::relocate(dst, src, n, typename is_trivially_relocatable<T>::type());
+}
+
 /*
  *
  * Implementation of vector
@@ -669,6 +908,9 @@ vector<T>::vector(uint8_t data[], size_type size)
 :   _data(data)
 ,   _max_size(size / sizeof(T))
 ,   _size(0)
+#if defined(ESTL_TRACK_USAGE)
+,   _usage("vector", sizeof(T), size / sizeof(T))
+#endif
 {}
 
 template<class T>
@@ -689,19 +931,34 @@ vector<T>::operator=(const vector<T>& other)
 
     estd_assert(_max_size >= other._size);
 
-    if (size() >= other.size())
-    {
-        std::copy(other.cbegin(), other.cend(), begin());
-        erase(begin() + other.size(), end());
-    }
-    else
+    assign_from(other, typename is_trivially_copyable<T>::type());
+
+    return *this;
+}
+
+#if __cplusplus >= 201103L
+template<class T>
+vector<T>&
+vector<T>::operator=(vector<T>&& other)
+{
+    // identical vector
+    if(_data == other._data)
     {
-        std::copy(other.cbegin(), other.cbegin() + size(), begin());
-        insert(begin() + size(), other.cbegin() + size(), other.cend());
+        return *this;
     }
 
+    estd_assert(_max_size >= other._size);
+
+    clear();
+    relocate(begin(), other.begin(), other._size);
+    _size = other._size;
+    other._size = 0;
+    estd_track_insert(_usage, _size, _size);
+    estd_track_erase(other._usage, _size);
+
     return *this;
 }
+#endif
 
 template<class T>inline
 void
@@ -709,11 +966,9 @@ vector<T>::assign(size_type n, const_reference value)
 {
     clear();
     n = std::min(n, max_size());
-    while (n > 0)
-    {
-        emplace_back().construct(value);
-        --n;
-    }
+    fill(begin(), n, value, typename is_trivially_copyable<T>::type());
+    _size = n;
+    estd_track_insert(_usage, _size, n);
 }
 
 template<class T>
@@ -908,7 +1163,9 @@ typename vector<T>::reference
 vector<T>::push_back()
 {
     estd_assert(!full());
-    return *new(&_data[sizeof(T) * _size++])T();
+    reference value = *new(&_data[sizeof(T) * _size++])T();
+    estd_track_insert(_usage, _size, 1);
+    return value;
 }
 
 template<class T>inline
@@ -917,14 +1174,28 @@ vector<T>::push_back(const_reference value)
 {
     estd_assert(!full());
     (void)*new(&_data[sizeof(T) * _size++])T(value);
+    estd_track_insert(_usage, _size, 1);
+}
+
+#if __cplusplus >= 201103L
+template<class T>inline
+void
+vector<T>::push_back(value_type&& value)
+{
+    estd_assert(!full());
+    (void)*new(&_data[sizeof(T) * _size++])T(std::move(value));
+    estd_track_insert(_usage, _size, 1);
 }
+#endif
 
 template<class T>inline
 constructor<T>
 vector<T>::emplace_back()
 {
     estd_assert(!full());
-    return constructor<T>(&_data[sizeof(T) * _size++]);
+    uint8_t* const memory = &_data[sizeof(T) * _size++];
+    estd_track_insert(_usage, _size, 1);
+    return constructor<T>(memory);
 }
 
 template<class T>inline
@@ -933,8 +1204,9 @@ vector<T>::emplace(const_iterator position)
 {
     estd_assert(!full());
     iterator dst = const_cast<iterator>(position);
-    memmove(dst + 1, position, (sizeof(T) * (cend() - position)));
+    relocate(dst + 1, dst, cend() - position);
     ++_size;
+    estd_track_insert(_usage, _size, 1);
     return constructor<T>(reinterpret_cast<uint8_t*>(dst));
 }
 
@@ -943,7 +1215,8 @@ void
 vector<T>::pop_back()
 {
     estd_assert(size() > 0);
-    reinterpret_cast<T*>(&_data[sizeof(T) * _size--])->~T();
+    reinterpret_cast<T*>(&_data[sizeof(T) * --_size])->~T();
+    estd_track_erase(_usage, 1);
 }
 
 template<class T>inline
@@ -952,11 +1225,27 @@ vector<T>::insert(const_iterator position, const_reference value)
 {
     estd_assert(size() < max_size());
     iterator dst = const_cast<iterator>(position);
-    memmove(dst + 1, position, (sizeof(T) * (cend() - position)));
+    relocate(dst + 1, dst, cend() - position);
     (void)new(dst)value_type(value);
     ++_size;
+    estd_track_insert(_usage, _size, 1);
+    return dst;
+}
+
+#if __cplusplus >= 201103L
+template<class T>inline
+typename vector<T>::iterator
+vector<T>::insert(const_iterator position, value_type&& value)
+{
+    estd_assert(size() < max_size());
+    iterator dst = const_cast<iterator>(position);
+    relocate(dst + 1, dst, cend() - position);
+    (void)new(dst)value_type(std::move(value));
+    ++_size;
+    estd_track_insert(_usage, _size, 1);
     return dst;
 }
+#endif
 
 template<class T>inline
 void
@@ -964,12 +1253,10 @@ vector<T>::insert(const_iterator position, size_type n, const_reference value)
 {
     estd_assert((size() + n) <= max_size());
     iterator dst = const_cast<iterator>(position);
-    memmove(dst + n, position, (sizeof(T) * (cend() - position)));
-    for (size_t i = 0; i < n; ++i)
-    {
-        (void)new(dst++)value_type(value);
-    }
+    relocate(dst + n, dst, cend() - position);
+    fill(dst, n, value, typename is_trivially_copyable<T>::type());
     _size += n;
+    estd_track_insert(_usage, _size, n);
 }
 
 template<class T>
@@ -1002,9 +1289,10 @@ vector<T>::erase(const_iterator position)
 
     if (position + 1 != cend())
     {
-        memmove(item, position + 1, sizeof(T) * (cend() - position - 1));
+        relocate(item, item + 1, cend() - position - 1);
     }
     --_size;
+    estd_track_erase(_usage, 1);
     return item;
 }
 
@@ -1018,8 +1306,9 @@ vector<T>::erase(const_iterator first, const_iterator last)
     {
         i->~T();
     }
-    memmove(iterator(first), iterator(last), (sizeof(T) * (cend() - last)));
+    relocate(iterator(first), iterator(last), cend() - last);
     _size -= (last - first);
+    estd_track_erase(_usage, static_cast<size_type>(last - first));
     return iterator(first);
 }
 
@@ -1031,16 +1320,123 @@ vector<T>::clear()
     {
         reinterpret_cast<T*>(&_data[sizeof(T) * i])->~T();
     }
+    estd_track_erase(_usage, _size);
     _size = 0;
 }
 
-template<class T>inline
+template<class T>
 void
 vector<T>::swap(vector<T>& other)
 {
-    std::swap(_data, other._data);
-    std::swap(_max_size, other._max_size);
+    // identical vector
+    if(_data == other._data)
+    {
+        return;
+    }
+
+    estd_assert(_max_size >= other._size);
+    estd_assert(other._max_size >= _size);
+
+    vector<T>& smaller = (_size < other._size) ? *this : other;
+    vector<T>& larger = (_size < other._size) ? other : *this;
+    size_type const common = smaller._size;
+    internal::swap_elements(
+        begin(),
+        other.begin(),
+        common,
+        typename is_trivially_relocatable<T>::type());
+    relocate(smaller.begin() + common, larger.begin() + common, larger._size - common);
     std::swap(_size, other._size);
+    estd_track_insert(smaller._usage, smaller._size, smaller._size - common);
+    estd_track_erase(larger._usage, smaller._size - common);
+}
+
+#if defined(ESTL_TRACK_USAGE)
+template<class T>inline
+container_usage&
+vector<T>::usage()
+{
+    return _usage;
+}
+
+template<class T>inline
+const container_usage&
+vector<T>::usage() const
+{
+    return _usage;
+}
+#endif
+
+template<class T>inline
+void
+vector<T>::assign_from(const vector<T>& other, true_type)
+{
+    // no destructors to call, simply overwrite the raw memory
+#if defined(ESTL_TRACK_USAGE)
+    size_type const previous = _size;
+#endif
+    _size = std::min(other._size, _max_size);
+    memcpy(_data, other._data, sizeof(T) * _size);
+#if defined(ESTL_TRACK_USAGE)
+    if (_size > previous)
+    {
+        estd_track_insert(_usage, _size, _size - previous);
+    }
+    else
+    {
+        estd_track_erase(_usage, previous - _size);
+    }
+#endif
+}
+
+template<class T>
+void
+vector<T>::assign_from(const vector<T>& other, false_type)
+{
+    if (size() >= other.size())
+    {
+        std::copy(other.cbegin(), other.cend(), begin());
+        erase(begin() + other.size(), end());
+    }
+    else
+    {
+        std::copy(other.cbegin(), other.cbegin() + size(), begin());
+        insert(begin() + size(), other.cbegin() + size(), other.cend());
+    }
+}
+
+template<class T>
+void
+vector<T>::fill(iterator position, size_type n, const_reference value, true_type)
+{
+    if (n == 0)
+    {
+        return;
+    }
+    if (sizeof(T) == 1)
+    {
+        memset(position, *reinterpret_cast<const uint8_t*>(&value), n);
+        return;
+    }
+    // copy the first element and then double the filled range with every memcpy
+    memcpy(position, &value, sizeof(T));
+    size_type filled = 1;
+    while (filled < n)
+    {
+        size_type const count = std::min(filled, n - filled);
+        memcpy(position + filled, position, sizeof(T) * count);
+        filled += count;
+    }
+}
+
+template<class T>inline
+void
+vector<T>::fill(iterator position, size_type n, const_reference value, false_type)
+{
+    for (size_type i = 0; i < n; ++i)
+    {
+        (void)new(position + i)value_type(value);
+    }
 }
 
 template<class T>
@@ -1061,7 +1457,7 @@ vector<T>::range_insert(
 }
 
 template<class T>
-template<class ForwardIterator>inline
+template<class ForwardIterator>
 void
 vector<T>::range_insert(
     const_iterator position,
@@ -1069,69 +1465,138 @@ vector<T>::range_insert(
     ForwardIterator last,
     std::forward_iterator_tag)
 {
-    while (!full() && (first != last))
+    // shift the tail only once, surplus elements are dropped
+    size_type const n = std::min(
+        static_cast<size_type>(std::distance(first, last)),
+        max_size() - size());
+    if (n == 0)
     {
-        insert(position, *first);
-        ++position;
-        ++first;
+        return;
+    }
+    iterator dst = const_cast<iterator>(position);
+    relocate(dst + n, dst, cend() - position);
+
+    // only ranges of T can be copied with memcpy
+    typedef integral_constant<bool,
+            is_trivially_copyable<T>::value
+        &&  is_pointer<ForwardIterator>::value
+        &&  is_same<typename remove_cv<typename remove_pointer<ForwardIterator>::type>::type, T>::value
+        > memcpy_possible;
+    copy_construct(dst, first, n, memcpy_possible());
+    _size += n;
+    estd_track_insert(_usage, _size, n);
+}
+
+template<class T>
+template<class ForwardIterator>inline
+void
+vector<T>::copy_construct(iterator position, ForwardIterator first, size_type n, true_type)
+{
+    memcpy(position, &*first, sizeof(T) * n);
+}
+
+template<class T>
+template<class ForwardIterator>inline
+void
+vector<T>::copy_construct(iterator position, ForwardIterator first, size_type n, false_type)
+{
+    for (size_type i = 0; i < n; ++i, ++first)
+    {
+        (void)new(position + i)value_type(*first);
     }
 }
 
 namespace declare
 {
 
-    template<class T, std::size_t N>
-    vector<T, N>::vector()
-    :   ::esrlabs::estd::vector<T>(_data, sizeof(_data))
+    template<class T, std::size_t N, std::size_t Alignment>
+    vector<T, N, Alignment>::vector()
+    :   ::esrlabs::estd::vector<T>(_data.data, sizeof(T) * N)
     ,   _data()
     {}
 
-    template<class T, std::size_t N>
-    vector<T, N>::vector(size_type n, const_reference value)
-    :   ::esrlabs::estd::vector<T>(_data, sizeof(_data))
+    template<class T, std::size_t N, std::size_t Alignment>
+    vector<T, N, Alignment>::vector(size_type n, const_reference value)
+    :   ::esrlabs::estd::vector<T>(_data.data, sizeof(T) * N)
     ,   _data()
     {
         base::assign(std::min(n, N), value);
     }
 
-    template<class T, size_t N>
-    vector<T, N>::vector(const estd::vector<T>& other)
-    :   ::esrlabs::estd::vector<T>(_data, sizeof(_data))
+    template<class T, size_t N, std::size_t Alignment>
+    vector<T, N, Alignment>::vector(const estd::vector<T>& other)
+    :   ::esrlabs::estd::vector<T>(_data.data, sizeof(T) * N)
     ,   _data()
     {
         base::operator=(other);
     }
 
-    template<class T, size_t N>
-    vector<T, N>::vector(const estd::declare::vector<T, N>& other)
-    :   ::esrlabs::estd::vector<T>(_data, sizeof(_data))
+    template<class T, size_t N, std::size_t Alignment>
+    vector<T, N, Alignment>::vector(const this_type& other)
+    :   ::esrlabs::estd::vector<T>(_data.data, sizeof(T) * N)
     ,   _data()
     {
         base::operator=(other);
     }
 
-    template<class T, size_t N>
-    vector<T, N>::~vector()
+#if __cplusplus >= 201103L
+    template<class T, size_t N, std::size_t Alignment>
+    vector<T, N, Alignment>::vector(base&& other)
+    :   ::esrlabs::estd::vector<T>(_data.data, sizeof(T) * N)
+    ,   _data()
+    {
+        base::operator=(std::move(other));
+    }
+
+    template<class T, size_t N, std::size_t Alignment>
+    vector<T, N, Alignment>::vector(this_type&& other)
+    :   ::esrlabs::estd::vector<T>(_data.data, sizeof(T) * N)
+    ,   _data()
+    {
+        base::operator=(std::move(other));
+    }
+#endif
+
+    template<class T, size_t N, std::size_t Alignment>
+    vector<T, N, Alignment>::~vector()
     {
         base::clear();
     }
 
-    template<class T, size_t N>
-    vector<T, N>&
-    vector<T, N>::operator=(const esrlabs::estd::vector<T>& other)
+    template<class T, size_t N, std::size_t Alignment>
+    vector<T, N, Alignment>&
+    vector<T, N, Alignment>::operator=(const esrlabs::estd::vector<T>& other)
     {
         base::operator=(other);
         return *this;
     }
 
-    template<class T, size_t N>
-    vector<T, N>&
-    vector<T, N>::operator=(const esrlabs::estd::declare::vector<T, N>& other)
+    template<class T, size_t N, std::size_t Alignment>
+    vector<T, N, Alignment>&
+    vector<T, N, Alignment>::operator=(const this_type& other)
     {
         base::operator=(other);
         return *this;
     }
 
+#if __cplusplus >= 201103L
+    template<class T, size_t N, std::size_t Alignment>
+    vector<T, N, Alignment>&
+    vector<T, N, Alignment>::operator=(base&& other)
+    {
+        base::operator=(std::move(other));
+        return *this;
+    }
+
+    template<class T, size_t N, std::size_t Alignment>
+    vector<T, N, Alignment>&
+    vector<T, N, Alignment>::operator=(this_type&& other)
+    {
+        base::operator=(std::move(other));
+        return *this;
+    }
+#endif
+
 } /* namespace declare */
 
 } /* namespace estd */
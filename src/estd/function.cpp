@@ -0,0 +1,43 @@
+/*
+ * \copyright   E.S.R.Labs AG, 2014, All rights reserved.
+ */
+#include <estd/function.h>
+
+#include <cstring>
+
+namespace esrlabs {
+namespace estd {
+namespace internal {
+
+void
+function_base::copy(const function_base& other)
+{
+    if (&other == this)
+    {
+        return;
+    }
+    clear();
+    if (other._invoker == 0L)
+    {
+        return;
+    }
+    estd_assert(other._size <= _capacity);
+    if (other._manager != 0L)
+    {
+        other._manager(_storage, other._storage);
+    }
+    else
+    {
+        // trivially copyable callable
+        (void)memcpy(_storage, other._storage, other._size);
+    }
+    _size = other._size;
+    _invoker = other._invoker;
+    _manager = other._manager;
+}
+
+} /* namespace internal */
+
+} /* namespace estd */
+
+} /* namespace esrlabs */
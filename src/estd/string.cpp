@@ -0,0 +1,341 @@
+/*
+ * \copyright   E.S.R.Labs AG, 2014, All rights reserved.
+ */
+#include <cstring>
+
+#include <estd/string.h>
+
+namespace esrlabs {
+namespace estd {
+
+/*
+ * Number formatting. The digits are written backwards into a local buffer
+ * ending at the given position, two decimal digits per division.
+ */
+
+static const char DIGIT_PAIRS[] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+static const char HEX_DIGITS[] = "0123456789abcdef";
+
+/*
+ * Enough for 20 decimal digits, MAX_DECIMALS leading zeros, sign and point.
+ */
+static const std::size_t FORMAT_BUFFER_SIZE = 48;
+
+static char*
+format_pair(char* end, uint32_t pair)
+{
+    end -= 2;
+    end[0] = DIGIT_PAIRS[2 * pair];
+    end[1] = DIGIT_PAIRS[2 * pair + 1];
+    return end;
+}
+
+static char*
+format_decimal(char* end, uint32_t value)
+{
+    while (value >= 100)
+    {
+        uint32_t const pair = value % 100;
+        value /= 100;
+        end = format_pair(end, pair);
+    }
+    if (value >= 10)
+    {
+        return format_pair(end, value);
+    }
+    *--end = static_cast<char>('0' + value);
+    return end;
+}
+
+static char*
+format_decimal(char* end, uint64_t value)
+{
+    // 64 bit divisions are expensive on 32 bit targets: split off blocks of
+    // eight digits and format those with 32 bit arithmetic
+    while (value > 0xFFFFFFFFU)
+    {
+        uint32_t low = static_cast<uint32_t>(value % 100000000U);
+        value /= 100000000U;
+        for (int i = 0; i < 4; ++i)
+        {
+            end = format_pair(end, low % 100);
+            low /= 100;
+        }
+    }
+    return format_decimal(end, static_cast<uint32_t>(value));
+}
+
+/*
+ * string
+ */
+
+const string::size_type string::npos;
+const string::size_type string::MAX_DECIMALS;
+
+string::string(char data[], size_type capacity)
+: _data(data)
+, _capacity(capacity)
+, _size(0)
+{
+    terminate();
+}
+
+string&
+string::assign(const char* s)
+{
+    return assign(s, std::strlen(s));
+}
+
+string&
+string::assign(const char* s, size_type n)
+{
+    _size = 0;
+    return append(s, n);
+}
+
+string&
+string::assign(const string& other)
+{
+    if (&other != this)
+    {
+        assign(other._data, other._size);
+    }
+    return *this;
+}
+
+string&
+string::assign(size_type n, char c)
+{
+    _size = 0;
+    return append(n, c);
+}
+
+string&
+string::append(const char* s)
+{
+    return append(s, std::strlen(s));
+}
+
+string&
+string::append(const char* s, size_type n)
+{
+    if (n > _capacity - _size)
+    {
+        n = _capacity - _size;
+    }
+    // memmove, s may point into this string
+    std::memmove(_data + _size, s, n);
+    _size += n;
+    terminate();
+    return *this;
+}
+
+string&
+string::append(const string& other)
+{
+    return append(other._data, other._size);
+}
+
+string&
+string::append(size_type n, char c)
+{
+    if (n > _capacity - _size)
+    {
+        n = _capacity - _size;
+    }
+    std::memset(_data + _size, c, n);
+    _size += n;
+    terminate();
+    return *this;
+}
+
+string&
+string::append_decimal(uint64_t magnitude, bool negative)
+{
+    char buffer[FORMAT_BUFFER_SIZE];
+    char* const end = buffer + sizeof(buffer);
+    char* first = (magnitude <= 0xFFFFFFFFU)
+        ? format_decimal(end, static_cast<uint32_t>(magnitude))
+        : format_decimal(end, magnitude);
+    if (negative)
+    {
+        *--first = '-';
+    }
+    return append(first, static_cast<size_type>(end - first));
+}
+
+string&
+string::append_hexadecimal(uint64_t value, size_type width)
+{
+    char buffer[2 * sizeof(uint64_t)];
+    char* const end = buffer + sizeof(buffer);
+    char* first = end;
+    do
+    {
+        *--first = HEX_DIGITS[value & 0xFU];
+        value >>= 4;
+    }
+    while (value != 0);
+    size_type const digits = static_cast<size_type>(end - first);
+    if (width > digits)
+    {
+        append(width - digits, '0');
+    }
+    return append(first, digits);
+}
+
+string&
+string::append_fixed_point(uint64_t magnitude, bool negative, size_type decimals)
+{
+    estd_assert(decimals <= MAX_DECIMALS);
+    char buffer[FORMAT_BUFFER_SIZE];
+    char* const end = buffer + sizeof(buffer);
+    char* first = (magnitude <= 0xFFFFFFFFU)
+        ? format_decimal(end, static_cast<uint32_t>(magnitude))
+        : format_decimal(end, magnitude);
+    if (decimals > 0)
+    {
+        // at least one digit in front of the point
+        char* const point = end - decimals;
+        while (first >= point)
+        {
+            *--first = '0';
+        }
+        std::memmove(first - 1, first, static_cast<size_type>(point - first));
+        --first;
+        *(point - 1) = '.';
+    }
+    if (negative)
+    {
+        *--first = '-';
+    }
+    return append(first, static_cast<size_type>(end - first));
+}
+
+string::size_type
+string::find(char c, size_type pos) const
+{
+    if (pos >= _size)
+    {
+        return npos;
+    }
+    const void* const found = std::memchr(_data + pos, c, _size - pos);
+    return (found == 0) ? npos : static_cast<size_type>(static_cast<const char*>(found) - _data);
+}
+
+string::size_type
+string::find(const char* s, size_type pos) const
+{
+    return find(s, pos, std::strlen(s));
+}
+
+string::size_type
+string::find(const char* s, size_type pos, size_type n) const
+{
+    if ((pos > _size) || (n > _size - pos))
+    {
+        return npos;
+    }
+    if (n == 0)
+    {
+        return pos;
+    }
+    // search the first character with memchr and compare the rest
+    const char* const last = _data + _size - n;
+    const char* current = _data + pos;
+    while (current <= last)
+    {
+        current = static_cast<const char*>(
+            std::memchr(current, s[0], static_cast<size_type>(last - current) + 1));
+        if (current == 0)
+        {
+            return npos;
+        }
+        if (std::memcmp(current + 1, s + 1, n - 1) == 0)
+        {
+            return static_cast<size_type>(current - _data);
+        }
+        ++current;
+    }
+    return npos;
+}
+
+string::size_type
+string::find(const string& other, size_type pos) const
+{
+    return find(other._data, pos, other._size);
+}
+
+string::size_type
+string::rfind(char c, size_type pos) const
+{
+    if (_size == 0)
+    {
+        return npos;
+    }
+    size_type i = (pos < _size) ? pos : (_size - 1);
+    for (;;)
+    {
+        if (_data[i] == c)
+        {
+            return i;
+        }
+        if (i == 0)
+        {
+            return npos;
+        }
+        --i;
+    }
+}
+
+int
+string::compare(const string& other) const
+{
+    return compare(other._data, other._size);
+}
+
+int
+string::compare(const char* s) const
+{
+    return compare(s, std::strlen(s));
+}
+
+int
+string::compare(const char* s, size_type n) const
+{
+    size_type const common = (_size < n) ? _size : n;
+    int const result = std::memcmp(_data, s, common);
+    if (result != 0)
+    {
+        return result;
+    }
+    return (_size < n) ? -1 : ((_size > n) ? 1 : 0);
+}
+
+bool
+operator==(const string& lhs, const string& rhs)
+{
+    return (lhs.size() == rhs.size())
+        && (std::memcmp(lhs.data(), rhs.data(), lhs.size()) == 0);
+}
+
+bool
+operator==(const string& lhs, const char* rhs)
+{
+    return lhs.compare(rhs) == 0;
+}
+
+} /* namespace estd */
+
+} /* namespace esrlabs */
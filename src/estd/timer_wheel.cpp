@@ -0,0 +1,253 @@
+/*
+ * \copyright   E.S.R.Labs AG, 2014, All rights reserved.
+ */
+#include <estd/timer_wheel.h>
+
+namespace esrlabs {
+namespace estd {
+
+const timer_wheel::tick_type timer_wheel::MAX_DELAY;
+
+timer_wheel::timer_wheel(
+    object_pool<timer>& timers,
+    timer_list slots[],
+    bitset_view& used,
+    size_type slotBits,
+    tick_type now)
+: _timers(timers)
+, _slots(slots)
+, _used(used)
+, _expiring()
+, _bits(slotBits)
+, _wheels((32 + slotBits - 1) / slotBits)
+, _mask((static_cast<tick_type>(1) << slotBits) - 1U)
+, _next(now + 1U)
+{
+}
+
+timer_wheel::~timer_wheel()
+{
+}
+
+timer_wheel::size_type
+timer_wheel::start(tick_type delay, void* context)
+{
+    estd_assert(delay <= MAX_DELAY);
+    timer& t = _timers.allocate().construct();
+    t.expires = now() + delay;
+    t.context = context;
+    place(t);
+    return _timers.index_of(&t);
+}
+
+void
+timer_wheel::stop(size_type timer)
+{
+    unlink(_timers.at(timer));
+    _timers.release_at(timer);
+}
+
+void
+timer_wheel::restart(size_type timer, tick_type delay)
+{
+    estd_assert(delay <= MAX_DELAY);
+    timer_wheel::timer& t = _timers.at(timer);
+    unlink(t);
+    t.expires = now() + delay;
+    place(t);
+}
+
+void
+timer_wheel::clear()
+{
+    size_type const slots = _wheels * (_mask + 1U);
+    for (size_type i = 0; i <= slots; ++i)
+    {
+        timer_list& list = (i < slots) ? _slots[i] : _expiring;
+        while (!list.empty())
+        {
+            timer_wheel::timer& t = list.front();
+            list.pop_front();
+            _timers.release(&t);
+        }
+    }
+    _used.reset();
+    // timers expiring right now are not in a list
+    _timers.clear();
+}
+
+/*
+ * Puts a timer into the slot of the lowest wheel whose range covers the
+ * remaining time. The slot is picked by the bits of the expiry time that
+ * belong to the wheel, so a timer of an upper wheel is cascaded to the
+ * lower wheels when the time reaches its slot.
+ */
+void
+timer_wheel::place(timer& t)
+{
+    tick_type const delta = t.expires - _next;
+    size_type index;
+    if (delta > MAX_DELAY)
+    {
+        // already due, expires with the next tick
+        index = _next & _mask;
+    }
+    else
+    {
+        size_type wheel = 0;
+        while ((wheel + 1 < _wheels) && ((delta >> (_bits * (wheel + 1))) != 0))
+        {
+            ++wheel;
+        }
+        index = wheel * (_mask + 1U) + ((t.expires >> (_bits * wheel)) & _mask);
+    }
+    t.list = static_cast<uint32_t>(index);
+    _slots[index].push_back(t);
+    _used.set(index);
+}
+
+void
+timer_wheel::unlink(timer& t)
+{
+    if (!t.is_linked())
+    {
+        // expiring right now and already handed out by advance()
+        return;
+    }
+    if (t.list == EXPIRING)
+    {
+        _expiring.erase(t);
+        return;
+    }
+    timer_list& slot = _slots[t.list];
+    slot.erase(t);
+    if (slot.empty())
+    {
+        _used.reset(t.list);
+    }
+}
+
+/*
+ * Empties a slot. The returned list has to be emptied by the caller before
+ * the slot is used again.
+ */
+timer_wheel::timer_list&
+timer_wheel::take(size_type index)
+{
+    _used.reset(index);
+    return _slots[index];
+}
+
+/*
+ * Returns the number of ticks from _next to the next tick at which a slot
+ * with timers is due, either to expire or to be cascaded, or the maximum
+ * of tick_type if there are no timers. A slot of a wheel is due at the
+ * first tick of the ticks it covers, so the wheels above the current one
+ * only need to be searched while their next slot starts before the best
+ * tick found so far.
+ */
+timer_wheel::tick_type
+timer_wheel::ticks_to_next_slot() const
+{
+    size_type const slots = _mask + 1U;
+    tick_type best = ~static_cast<tick_type>(0);
+    for (size_type wheel = 0; wheel < _wheels; ++wheel)
+    {
+        size_type const shift = _bits * wheel;
+        tick_type const span = static_cast<tick_type>(1) << shift;
+        // the first tick at or after _next that starts a slot of this wheel
+        tick_type const start = (_next + span - 1U) & ~(span - 1U);
+        tick_type const offset = start - _next;
+        if (offset >= best)
+        {
+            break;
+        }
+        size_type const first = wheel * slots;
+        size_type const index = (start >> shift) & _mask;
+        size_type used = first + index;
+        if (!_used.test(used))
+        {
+            used = _used.find_next(used);
+            if (used >= first + slots)
+            {
+                // wraps around to the slots of the next rotation
+                used = _used.test(first) ? first : _used.find_next(first);
+                if (used >= first + index)
+                {
+                    continue;
+                }
+            }
+        }
+        // the topmost wheel may cover less than a full rotation, which is
+        // taken care of by the arithmetic modulo the range of tick_type
+        tick_type const distance = offset
+            + (static_cast<tick_type>((used - first - index) & _mask) << shift);
+        if (distance < best)
+        {
+            best = distance;
+        }
+    }
+    return best;
+}
+
+/*
+ * Redistributes the timers of the upper wheel slots that start at tick.
+ * A wheel is only cascaded when all wheels below it have wrapped around.
+ */
+void
+timer_wheel::cascade(tick_type tick)
+{
+    for (size_type wheel = 1; wheel < _wheels; ++wheel)
+    {
+        tick_type const index = (tick >> (_bits * wheel)) & _mask;
+        timer_list moving;
+        moving.splice(moving.end(), take(wheel * (_mask + 1U) + index));
+        while (!moving.empty())
+        {
+            timer& t = moving.front();
+            moving.pop_front();
+            place(t);
+        }
+        if (index != 0)
+        {
+            break;
+        }
+    }
+}
+
+/*
+ * Moves the timers expiring with the next tick to the list of expiring
+ * timers, so timers started while they are handled cannot join them.
+ */
+void
+timer_wheel::collect()
+{
+    tick_type const index = _next & _mask;
+    if (index == 0)
+    {
+        cascade(_next);
+    }
+    _expiring.splice(_expiring.end(), take(index));
+    for (timer_list::iterator i = _expiring.begin(); i != _expiring.end(); ++i)
+    {
+        i->list = EXPIRING;
+    }
+    ++_next;
+}
+
+/*
+ * Stops an expired timer unless the expiry handler has stopped or
+ * restarted it.
+ */
+void
+timer_wheel::finish(size_type timer)
+{
+    if (_timers.is_allocated(timer) && !_timers.at(timer).is_linked())
+    {
+        _timers.release_at(timer);
+    }
+}
+
+} /* namespace estd */
+
+} /* namespace esrlabs */
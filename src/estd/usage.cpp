@@ -0,0 +1,100 @@
+/*
+ * \copyright   E.S.R.Labs AG, 2014, All rights reserved.
+ */
+#include <estd/usage.h>
+
+#if defined(ESTL_TRACK_USAGE)
+
+namespace esrlabs {
+namespace estd {
+
+static container_usage*& registry()
+{
+    // initialized on first use, containers may be constructed statically
+    static container_usage* first = 0L;
+    return first;
+}
+
+container_usage::container_usage(const char* kind, size_type elementSize, size_type capacity)
+: _previous(0L)
+, _next(registry())
+, _kind(kind)
+, _name(0L)
+, _element_size(elementSize)
+, _capacity(capacity)
+, _peak(0)
+, _full_hits(0)
+, _inserts(0)
+, _erases(0)
+{
+    if (_next != 0L)
+    {
+        _next->_previous = this;
+    }
+    registry() = this;
+}
+
+container_usage::~container_usage()
+{
+    if (_previous != 0L)
+    {
+        _previous->_next = _next;
+    }
+    else
+    {
+        registry() = _next;
+    }
+    if (_next != 0L)
+    {
+        _next->_previous = _previous;
+    }
+}
+
+const container_usage*
+container_usage::first()
+{
+    return registry();
+}
+
+void
+dump_usage(std::FILE* out)
+{
+    unsigned long capacityBytes = 0;
+    unsigned long peakBytes = 0;
+    (void)std::fprintf(out, "%-24s %-8s %8s %10s %10s %12s %12s %10s %10s %10s\n",
+        "container", "kind", "element", "capacity", "peak",
+        "capacity B", "peak B", "full hits", "inserts", "erases");
+    for (const container_usage* usage = container_usage::first();
+         usage != 0L;
+         usage = usage->next())
+    {
+        char address[24];
+        const char* name = usage->name();
+        if (name == 0L)
+        {
+            (void)std::sprintf(address, "%p", static_cast<const void*>(usage));
+            name = address;
+        }
+        (void)std::fprintf(out, "%-24s %-8s %8lu %10lu %10lu %12lu %12lu %10lu %10lu %10lu\n",
+            name,
+            usage->kind(),
+            static_cast<unsigned long>(usage->element_size()),
+            static_cast<unsigned long>(usage->capacity()),
+            static_cast<unsigned long>(usage->peak()),
+            static_cast<unsigned long>(usage->capacity_bytes()),
+            static_cast<unsigned long>(usage->peak_bytes()),
+            static_cast<unsigned long>(usage->full_hits()),
+            static_cast<unsigned long>(usage->inserts()),
+            static_cast<unsigned long>(usage->erases()));
+        capacityBytes += static_cast<unsigned long>(usage->capacity_bytes());
+        peakBytes += static_cast<unsigned long>(usage->peak_bytes());
+    }
+    (void)std::fprintf(out, "total capacity %lu bytes, peak %lu bytes\n",
+        capacityBytes, peakBytes);
+}
+
+} /* namespace estd */
+
+} /* namespace esrlabs */
+
+#endif /* ESTL_TRACK_USAGE */